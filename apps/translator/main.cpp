@@ -1,38 +1,295 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
 #include <iostream>
+#include <stdexcept>
 #include <fstream>
 #include <string>
+#include <vector>
+#include "translator/batch.h"
 #include "translator/lexer.h"
 #include "translator/parser.h"
 #include "translator/codegen.h"
+#include "translator/emitter.h"
+#include "translator/flat_ast.h"
+#include "translator/incremental.h"
+#include "translator/optimize.h"
+#include "translator/types.h"
+#include "translator/source.h"
+#include "translator/vm.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+/**
+ * \brief Sürecin en yüksek yerleşik bellek kullanımı (KiB).
+ * \return Ölçülemiyorsa 0
+ */
+static long peak_rss_kib(){
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return static_cast<long>(pmc.PeakWorkingSetSize / 1024);
+    return 0;
+#else
+    struct rusage ru{};
+    if (getrusage(RUSAGE_SELF, &ru) != 0) return 0;
+#if defined(__APPLE__)
+    return static_cast<long>(ru.ru_maxrss / 1024);
+#else
+    return static_cast<long>(ru.ru_maxrss);
+#endif
+#endif
+}
+
+/**
+ * \brief Sözdizim hatalarını `dosya:satır:sütun: error: ileti` biçiminde standart hataya yazar.
+ * \param input Girdi yolu
+ * \param diags Hatalar
+ */
+static void report_diagnostics(const std::string& input, const std::vector<translator::Diagnostic>& diags){
+    for (const auto& d : diags) std::cerr << input << ":" << d.line << ":" << d.column << ": error: " << d.message << "\n";
+    std::cerr.flush();
+}
+
+/**
+ * \brief Toplu çeviri sonuçlarını girdi sırasıyla standart hataya yazar.
+ * \param jobs Çeviri işleri
+ * \param results İş sonuçları
+ * \param timings Her dosya için süre satırı yazılsın mı?
+ * \return Başarısız dosya sayısı
+ */
+static std::size_t report_batch(const std::vector<translator::BatchJob>& jobs, const std::vector<translator::BatchResult>& results, bool timings){
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        const auto& r = results[i];
+        if (!r.ok && !r.diagnostics.empty()) { ++failed; report_diagnostics(jobs[i].input, r.diagnostics); }
+        else if (!r.ok) { ++failed; std::cerr << jobs[i].input << ": error: " << r.error << std::endl; }
+        else if (timings) std::cerr << std::fixed << std::setprecision(2) << std::setw(10) << r.millis << " ms  " << jobs[i].input << std::endl;
+    }
+    if (timings && !jobs.empty()) {
+        std::vector<std::size_t> order(jobs.size());
+        for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b){ return results[a].millis > results[b].millis; });
+        std::cerr << "slowest:" << std::endl;
+        for (std::size_t k = 0; k < order.size() && k < 5; ++k)
+            std::cerr << std::fixed << std::setprecision(2) << std::setw(10) << results[order[k]].millis << " ms  " << jobs[order[k]].input << std::endl;
+    }
+    return failed;
+}
 
 int main(int argc, char** argv) {
     if (argc < 2) {
-        std::cerr << "Usage: translator <input.bas> [-o output.cpp]" << std::endl;
+        std::cerr << "Usage: translator <input.bas|-> [-o output.cpp] [--mmap|--read|--stream] [--vars map|slots|locals] [--flow dispatch|blocks|structured] [-O] [--typed] [--run] [--cache file] [--pipeline] [--stats]" << std::endl;
+        std::cerr << "       translator <file.bas|dir|@manifest>... [-o outdir] [-j N] [--timings]" << std::endl;
         return 1;
     }
-    std::string inputPath = argv[1];
-    std::string outputPath;
-    for (int i = 2; i < argc; ++i) {
+    std::vector<std::string> inputs;
+    std::string outputPath, cachePath;
+    translator::SourceMode mode = translator::SourceMode::Auto;
+    translator::CodegenOptions cg;
+    bool stream = false, stats = false, timings = false, run = false, pipeline = false;
+    unsigned threads = 0;
+    for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
         if (arg == "-o" && i + 1 < argc) {
             outputPath = argv[++i];
+        } else if (arg == "-j" && i + 1 < argc) {
+            threads = static_cast<unsigned>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--mmap") {
+            mode = translator::SourceMode::Map;
+        } else if (arg == "--read") {
+            mode = translator::SourceMode::Read;
+        } else if (arg == "--vars" && i + 1 < argc) {
+            std::string v = argv[++i];
+            if (v == "map") cg.vars = translator::VarStorage::Map;
+            else if (v == "slots") cg.vars = translator::VarStorage::Slots;
+            else if (v == "locals") cg.vars = translator::VarStorage::Locals;
+            else { std::cerr << "Unknown --vars mode: " << v << std::endl; return 1; }
+        } else if (arg == "--flow" && i + 1 < argc) {
+            std::string v = argv[++i];
+            if (v == "dispatch") cg.flow = translator::ControlFlow::Dispatch;
+            else if (v == "blocks") cg.flow = translator::ControlFlow::Blocks;
+            else if (v == "structured") cg.flow = translator::ControlFlow::Structured;
+            else { std::cerr << "Unknown --flow mode: " << v << std::endl; return 1; }
+        } else if (arg == "-O" || arg == "--optimize") {
+            cg.optimize = true;
+        } else if (arg == "--typed") {
+            cg.typed = true;
+        } else if (arg == "--cache" && i + 1 < argc) {
+            cachePath = argv[++i];
+        } else if (arg == "--run") {
+            run = true;
+        } else if (arg == "--stream") {
+            stream = true;
+        } else if (arg == "--pipeline") {
+            pipeline = true;
+        } else if (arg == "--stats") {
+            stats = true;
+        } else if (arg == "--timings") {
+            timings = true;
+        } else {
+            inputs.push_back(arg);
         }
     }
 
-    std::ifstream in(inputPath);
-    if (!in) {
-        std::cerr << "Cannot open input: " << inputPath << std::endl;
+    auto t0 = std::chrono::steady_clock::now();
+    bool batch = inputs.size() > 1;
+    for (const auto& in : inputs) batch = batch || (!in.empty() && in[0] == '@') || std::filesystem::is_directory(in);
+    if (batch) {
+        if (run || stream || pipeline || stats || !cachePath.empty()) {
+            std::cerr << "Batch mode does not support --run, --stream, --pipeline, --cache or --stats (use --timings)" << std::endl;
+            return 1;
+        }
+        std::vector<translator::BatchJob> jobs;
+        try {
+            for (auto& in : translator::expand_inputs(inputs)) jobs.push_back({in, translator::output_path_for(in, outputPath)});
+            translator::check_unique_outputs(jobs);
+            if (!outputPath.empty()) std::filesystem::create_directories(outputPath);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        auto results = translator::run_batch(jobs, threads, mode, cg);
+        std::size_t failed = report_batch(jobs, results, timings);
+        std::chrono::duration<double, std::milli> wall = std::chrono::steady_clock::now() - t0;
+        std::cerr << "translated " << (jobs.size() - failed) << "/" << jobs.size() << " files in "
+                  << std::fixed << std::setprecision(1) << wall.count() << " ms" << std::endl;
+        return failed == 0 ? 0 : 1;
+    }
+    if (inputs.empty()) {
+        std::cerr << "No input file" << std::endl;
+        return 1;
+    }
+    const std::string& inputPath = inputs.front();
+    if (!cachePath.empty() && (stream || run || cg.optimize || cg.typed || cg.vars != translator::VarStorage::Map || cg.flow != translator::ControlFlow::Dispatch)) {
+        std::cerr << "--cache only supports the default output (--vars map --flow dispatch, no -O, --typed, --run or --stream)" << std::endl;
+        return 1;
+    }
+    if (pipeline && (run || cg.optimize || cg.typed || !cachePath.empty() || cg.vars != translator::VarStorage::Map || cg.flow != translator::ControlFlow::Dispatch)) {
+        std::cerr << "--pipeline only supports the default output (--vars map --flow dispatch, no -O, --typed, --run or --cache)" << std::endl;
         return 1;
     }
 
-    std::string source((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
-
-    translator::Lexer lexer(source);
-    auto tokens = lexer.tokenize();
-    translator::Parser parser(tokens);
-    auto program = parser.parseProgram();
-    auto code = translator::Codegen::emit_cpp(program);
-    if (!outputPath.empty()) { std::ofstream out(outputPath); out << code; }
+    std::string code;
+    const char* how = "stream";
+    translator::OptimizeStats ost;
+    translator::DeadCodeStats dst;
+    std::size_t int_vars = 0, all_vars = 0;
+    std::uint64_t steps = 0;
+    translator::TranslationCache cache;
+    bool written = false;
+    auto translate = [&](const translator::Program& prog){
+        translator::FlatProgram flat = translator::flatten(prog);
+        if (cg.optimize) { ost = translator::optimize(flat); dst = translator::eliminate_dead_code(flat); }
+        if (cg.typed && stats) { int_vars = translator::infer_types(flat).int_vars(); all_vars = flat.names.size(); }
+        if (!run) {
+            // Çıktı parça parça doğrudan dosyaya (ya da standart çıktıya) yazılır.
+            const std::string target = outputPath.empty() ? "-" : outputPath;
+            translator::Emitter out = translator::Emitter::open(target);
+            translator::Codegen::emit_cpp(flat, cg, out);
+            if (outputPath.empty()) out << '\n';
+            if (!out.flush()) throw std::runtime_error("Cannot write output: " + target);
+            written = true;
+            return;
+        }
+        translator::Bytecode bc = translator::compile_bytecode(flat);
+        translator::VM vm(bc);
+        steps = vm.run(std::cin, std::cout);
+    };
+    double first_byte_ms = -1;
+    auto since_start = [&]{ return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count(); };
+    // Çözümleyiciyi seçilen kipte çalıştırır; sözdizim hatası varsa false döner.
+    auto process = [&](const translator::Parser& parser){
+        if (!pipeline) {
+            translator::ParseResult res = parser.parse();
+            if (!res.ok()) { report_diagnostics(inputPath, res.errors); return false; }
+            translate(res.program);
+            return true;
+        }
+        // Her deyim tamamlanınca yazılır; çıktı parça parça boşaltılır.
+        const std::string target = outputPath.empty() ? "-" : outputPath;
+        translator::Emitter out = translator::Emitter::open(target);
+        translator::StreamCodegen gen(out);
+        auto errors = parser.parse_each([&](int label, const translator::Stmt* st, const translator::Interner& symbols){
+            gen.statement(label, st, symbols);
+            if (first_byte_ms < 0 && out.flushed() > 0) first_byte_ms = since_start();
+        });
+        if (!errors.empty()) {
+            report_diagnostics(inputPath, errors);
+            // Tampondaki yarım program yazılmaz; standart çıktıya önceden
+            // boşaltılmış parçalar ise geri alınamaz.
+            out.discard();
+            out = translator::Emitter();
+            if (!outputPath.empty()) std::remove(outputPath.c_str());
+            return false;
+        }
+        gen.finish();
+        if (outputPath.empty()) out << '\n';
+        if (!out.flush()) throw std::runtime_error("Cannot write output: " + target);
+        if (first_byte_ms < 0) first_byte_ms = since_start();
+        written = true;
+        return true;
+    };
+    try {
+        if (!cachePath.empty()) {
+            auto source = translator::SourceBuffer::open(inputPath, mode);
+            how = source.mapped() ? "mmap" : "read";
+            cache.load(cachePath);
+            code = cache.translate(source.view());
+            if (!cache.save(cachePath)) std::cerr << "warning: cannot write cache: " << cachePath << std::endl;
+        } else if (stream) {
+            std::ifstream fin;
+            if (inputPath != "-") {
+                fin.open(inputPath);
+                if (!fin) {
+                    std::cerr << "Cannot open input: " << inputPath << std::endl;
+                    return 1;
+                }
+            }
+            translator::StreamLexer lexer(inputPath == "-" ? std::cin : fin);
+            translator::Parser parser(lexer);
+            if (!process(parser)) return 1;
+        } else {
+            auto source = translator::SourceBuffer::open(inputPath, mode);
+            how = source.mapped() ? "mmap" : "read";
+            translator::Lexer lexer(source);
+            translator::Parser parser(lexer);
+            if (!process(parser)) return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    if (run || written) {
+        // Program ya da üretilen kod zaten yazıldı.
+    } else if (!outputPath.empty()) { std::ofstream out(outputPath); out << code; }
     else { std::cout << code << std::endl; }
+
+    if (stats) {
+        std::chrono::duration<double, std::milli> wall = std::chrono::steady_clock::now() - t0;
+        std::cerr << "input: " << how << "  wall: " << wall.count() << " ms  peak RSS: " << peak_rss_kib() << " KiB" << std::endl;
+        if (run) std::cerr << "run: " << steps << " instructions" << std::endl;
+        if (pipeline) std::cerr << "pipeline: first byte after " << first_byte_ms << " ms" << std::endl;
+        if (!cachePath.empty())
+            std::cerr << "cache: " << cache.stats().hits << " hits, " << cache.stats().misses << " misses"
+                      << (cache.stats().fallback ? " (full translation)" : "") << std::endl;
+        if (cg.typed) std::cerr << "types: " << int_vars << "/" << all_vars << " variables std::int64_t" << std::endl;
+        if (cg.optimize)
+            std::cerr << "optimize: " << ost.eliminated() << "/" << ost.nodes_before << " nodes eliminated (folded " << ost.folded
+                      << ", simplified " << ost.simplified << ", propagated " << ost.propagated << "), "
+                      << dst.removed() << "/" << dst.stmts_before << " statements removed (unreachable " << dst.unreachable
+                      << ", dead LET " << dst.dead_stores << ")" << std::endl;
+    }
     return 0;
 }
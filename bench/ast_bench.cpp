@@ -0,0 +1,82 @@
+/**
+ * @file ast_bench.cpp
+ * @brief İşaretçi tabanlı ve düz AST üzerinde geçiş maliyeti ölçümleri.
+ */
+#include "bench_common.h"
+#include <filesystem>
+#include "translator/cfg.h"
+#include "translator/codegen.h"
+#include "translator/flat_ast.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+
+namespace bench {
+
+namespace {
+
+/** \brief İşaretçi ağacında ikili düğüm sayar (tipik bir özyinelemeli geçiş). */
+std::size_t count_binary(const translator::Expr* e){
+    if (e->kind() != translator::ExprKind::Binary) return 0;
+    auto* b = static_cast<const translator::BinaryExpr*>(e);
+    return 1 + count_binary(b->lhs) + count_binary(b->rhs);
+}
+
+/** \brief Program'daki tüm ifadelerde ikili düğüm sayar. */
+std::size_t count_binary(const translator::Program& p){
+    std::size_t n = 0;
+    for (const translator::Stmt* st : p.stmts){
+        switch (st->kind()){
+            case translator::StmtKind::Let: n += count_binary(static_cast<const translator::LetStmt*>(st)->expr); break;
+            case translator::StmtKind::IfGoto: n += count_binary(static_cast<const translator::IfGotoStmt*>(st)->cond); break;
+            case translator::StmtKind::Print: for (auto* e : static_cast<const translator::PrintStmt*>(st)->items) n += count_binary(e); break;
+            default: break;
+        }
+    }
+    return n;
+}
+
+} // namespace
+
+/**
+ * \brief flatten() maliyetini ve iki gösterimde aynı geçişlerin sürelerini raporlar.
+ * \param scale Üretilecek deyim sayısı
+ */
+void run_ast(int scale){
+    translator::Lexer lx(make_basic_corpus(scale));
+    translator::Parser ps(lx);
+    const translator::Program prog = ps.parseProgram();
+    translator::FlatProgram flat;
+    double conv = best_of(5, [&]{ flat = translator::flatten(prog); });
+    report("ast/flatten", conv, static_cast<double>(prog.stmts.size()), "stmts");
+
+    std::size_t bins = 0;
+    double walk_ptr = best_of(5, [&]{ bins = count_binary(prog); });
+    report("ast/walk exprs (pointer)", walk_ptr, static_cast<double>(bins), "nodes");
+    double walk_flat = best_of(5, [&]{
+        bins = 0;
+        for (translator::ExprKind k : flat.expr_kind) bins += k == translator::ExprKind::Binary;
+    });
+    report("ast/walk exprs (flat)", walk_flat, static_cast<double>(bins), "nodes");
+
+    double cfg_ptr = best_of(3, [&]{ translator::build_cfg(prog); });
+    report("ast/build_cfg (pointer)", cfg_ptr, static_cast<double>(prog.stmts.size()), "stmts");
+    double cfg_flat = best_of(3, [&]{ translator::build_cfg(flat); });
+    report("ast/build_cfg (flat)", cfg_flat, static_cast<double>(flat.size()), "stmts");
+
+    std::size_t bytes = 0;
+    double emit = best_of(3, [&]{ bytes = translator::Codegen::emit_cpp(flat).size(); });
+    report("ast/emit_cpp (flat)", emit, static_cast<double>(bytes), "bytes");
+
+    // Aynı çıktı bellekte birikmeden 64 KiB'lık parçalarla dosyaya yazılır.
+    const std::string path = (std::filesystem::temp_directory_path() / "translator_bench_emit.cpp").string();
+    double to_file = best_of(3, [&]{
+        translator::Emitter out = translator::Emitter::open(path);
+        translator::Codegen::emit_cpp(flat, {}, out);
+        out.flush();
+        bytes = out.size();
+    });
+    report("ast/emit_cpp (flat) -> file", to_file, static_cast<double>(bytes), "bytes");
+    std::error_code ec; std::filesystem::remove(path, ec);
+}
+
+} // namespace bench
@@ -0,0 +1,93 @@
+/**
+ * @file bench_common.h
+ * @brief translator_bench için ortak zamanlama ve girdi üretme yardımcıları
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace bench {
+
+/**
+ * @brief Verilen işlevi `reps` kez çalıştırır ve en iyi süreyi döndürür
+ * @param reps Tekrar sayısı
+ * @param fn Ölçülecek işlev
+ * @return En kısa çalışma süresi (saniye)
+ */
+template <typename F>
+double best_of(int reps, F&& fn){
+    double best = 1e300;
+    for (int r=0;r<reps;++r){
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        std::chrono::duration<double> d = std::chrono::steady_clock::now() - t0;
+        if (d.count() < best) best = d.count();
+    }
+    return best;
+}
+
+/**
+ * @brief Bir ölçüm satırını tek tip biçimde yazar
+ * @param name Ölçüm adı
+ * @param seconds Süre (saniye)
+ * @param items İşlenen öğe sayısı
+ * @param unit Öğe birimi (ör. "tokens")
+ */
+inline void report(const char* name, double seconds, double items, const char* unit){
+    std::printf("%-34s %10.3f ms  %12.0f %s/s\n", name, seconds*1e3, items/seconds, unit);
+}
+
+/**
+ * @brief Tipik BASIC satırlarından oluşan yapay bir program üretir
+ * @param lines Satır sayısı
+ * @return Üretilen kaynak metin
+ */
+inline std::string make_basic_corpus(int lines){
+    static const char* const kBodies[] = {
+        "LET COUNTER = COUNTER + 1",
+        "PRINT COUNTER, TOTAL * 2",
+        "LET TOTAL = (TOTAL + COUNTER) * 3 / 2",
+        "IF COUNTER THEN 10",
+        "GOSUB 10",
+        "INPUT VALUE",
+        "LET ALPHA_1 = BETA_2 - GAMMA_3",
+        "RETURN",
+    };
+    std::string s; s.reserve(static_cast<std::size_t>(lines) * 32);
+    for (int i=0;i<lines;++i){
+        s += std::to_string((i+1)*10); s += ' ';
+        s += kBodies[i % (sizeof(kBodies)/sizeof(kBodies[0]))]; s += '\n';
+    }
+    return s;
+}
+
+/**
+ * @brief Üretilen C++ kaynağını sistem derleyicisiyle (-O2) derleyip çalıştırır
+ * @param name Ölçüm adı (geçici dosya adı olarak da kullanılır)
+ * @param code C++ kaynağı
+ * @return En iyi çalıştırma süresi (saniye); başarısızsa negatif
+ */
+double compile_and_run(const std::string& name, const std::string& code);
+
+/// Lexer ölçümleri (tokenize, tokenize_view ve StreamLexer karşılaştırması).
+void run_lexer(int scale);
+/// Anahtar sözcük tanıma ölçümleri (if-else zinciri ve mükemmel özet).
+void run_keywords(int scale);
+/// Tarama çekirdeklerinin komut kümelerine göre ölçümü.
+void run_scan(int scale);
+/// Parser ölçümleri (AST kurma ve Program yıkımı).
+void run_parser(int scale);
+/// İşaretçi tabanlı ve düz AST geçişlerinin karşılaştırması.
+void run_ast(int scale);
+/// Üretilen programların kod üretim kiplerine göre çalışma süresi.
+void run_codegen(int scale);
+/// Deyim başına dağıtım (switch(pc)) maliyeti: dispatch, blocks ve structured.
+void run_dispatch(int scale);
+/// Yorumlayıcı, bayt kodu VM'i ve derlenmiş çıktının deyim başına süresi.
+void run_interp(int scale);
+
+} // namespace bench
@@ -0,0 +1,197 @@
+/**
+ * @file codegen_bench.cpp
+ * @brief Üretilen C++ programlarının çalışma süresi ölçümleri.
+ *
+ * Her kip için kod üretilir, sistem derleyicisiyle (-O2) derlenir ve
+ * çalıştırılır; yalnızca çalıştırma süresi raporlanır.
+ */
+#include "bench_common.h"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include "translator/codegen.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+
+#ifndef TRANSLATOR_BENCH_CXX
+#define TRANSLATOR_BENCH_CXX "c++"
+#endif
+
+namespace fs = std::filesystem;
+
+namespace bench {
+
+namespace {
+
+/**
+ * \brief Sıkı sayısal döngü: her tur birkaç değişken okur ve yazar.
+ * \param iters Döngü tur sayısı
+ */
+std::string make_loop_kernel(int iters){
+    return "10 LET I = " + std::to_string(iters) + "\n"
+           "20 LET S = S + I * 2 / 3\n"
+           "30 LET T = T + S - I\n"
+           "40 LET I = I - 1\n"
+           "50 IF I THEN 20\n"
+           "60 PRINT S, T\n";
+}
+
+/**
+ * \brief Yalnızca tamsayı aritmetiği yapan döngü; infer_types() tüm değişkenleri tamsayı bulur.
+ * \param iters Döngü tur sayısı
+ */
+std::string make_int_kernel(int iters){
+    return "10 LET I = " + std::to_string(iters) + "\n"
+           "20 LET A = I * 3 - A\n"
+           "30 LET B = B + A - I\n"
+           "40 LET C = C + (A > B)\n"
+           "50 LET I = I - 1\n"
+           "60 IF I > 0 THEN 20\n"
+           "70 PRINT A, B, C\n";
+}
+
+/**
+ * \brief make_int_kernel() gövdesi, sayacı FOR/NEXT ile artan döngüde.
+ * \param iters Döngü tur sayısı
+ */
+std::string make_for_kernel(int iters){
+    return "10 FOR I = 1 TO " + std::to_string(iters) + "\n"
+           "20 LET A = I * 3 - A\n"
+           "30 LET B = B + A - I\n"
+           "40 LET C = C + (A > B)\n"
+           "50 NEXT I\n"
+           "60 PRINT A, B, C\n";
+}
+
+/**
+ * \brief Uzun düz gövdeli döngü: her tur `body` kadar basit deyim çalıştırır.
+ * \param iters Döngü tur sayısı
+ * \param body Gövdedeki LET sayısı
+ */
+std::string make_straight_kernel(int iters, int body){
+    std::string s = "10 LET I = " + std::to_string(iters) + "\n";
+    int line = 20;
+    for (int k=0;k<body;++k, line += 10)
+        s += std::to_string(line) + " LET " + std::string(1, static_cast<char>('A' + k % 8)) + " = " + std::string(1, static_cast<char>('A' + (k + 1) % 8)) + " + I\n";
+    s += std::to_string(line) + " LET I = I - 1\n";
+    s += std::to_string(line + 10) + " IF I THEN 20\n";
+    s += std::to_string(line + 20) + " PRINT A, H\n";
+    return s;
+}
+
+} // namespace
+
+/**
+ * \brief Kodu derler ve çalıştırır.
+ * \param name Ölçüm adı (dosya adı olarak da kullanılır)
+ * \param code Üretilen C++ kaynağı
+ * \return En iyi çalıştırma süresi (saniye); derleme ya da çalıştırma başarısızsa negatif
+ */
+double compile_and_run(const std::string& name, const std::string& code){
+    fs::path dir = fs::temp_directory_path() / "translator_bench";
+    fs::create_directories(dir);
+    std::string stem;
+    for (char c : name) stem += (c == '/' || c == ' ' || c == '=') ? '_' : c;
+    fs::path src = dir / (stem + ".cpp"), exe = dir / stem;
+    std::ofstream(src) << code;
+    std::string cc = std::string(TRANSLATOR_BENCH_CXX) + " -O2 -o \"" + exe.string() + "\" \"" + src.string() + "\"";
+    if (std::system(cc.c_str()) != 0){ std::printf("%-34s (derleme başarısız)\n", name.c_str()); return -1; }
+    std::string run = "\"" + exe.string() + "\" > \"" + (dir / (stem + ".out")).string() + "\"";
+    int rc = 0;
+    double t = best_of(3, [&]{ rc = std::system(run.c_str()); });
+    if (rc != 0){ std::printf("%-34s (çalıştırma başarısız)\n", name.c_str()); return -1; }
+    return t;
+}
+
+namespace {
+
+/**
+ * \brief Kodu derler, çalıştırır ve tur başına hızı raporlar.
+ * \param name Ölçüm adı
+ * \param code Üretilen C++ kaynağı
+ * \param iters Program içindeki döngü tur sayısı
+ */
+void compile_and_time(const std::string& name, const std::string& code, int iters){
+    double t = compile_and_run(name, code);
+    if (t >= 0) report(name.c_str(), t, static_cast<double>(iters), "iters");
+}
+
+} // namespace
+
+/**
+ * \brief Aynı döngü çekirdeğini her değişken saklama ve kontrol akışı kipinde çalıştırır.
+ * \param scale Döngü tur sayısı
+ */
+void run_codegen(int scale){
+    translator::Lexer lx(make_loop_kernel(scale));
+    translator::Parser ps(lx);
+    const translator::Program prog = ps.parseProgram();
+    using translator::ControlFlow; using translator::VarStorage;
+    const struct { const char* name; VarStorage vars; ControlFlow flow; } kModes[] = {
+        {"codegen/vars=map", VarStorage::Map, ControlFlow::Dispatch},
+        {"codegen/vars=slots", VarStorage::Slots, ControlFlow::Dispatch},
+        {"codegen/vars=locals", VarStorage::Locals, ControlFlow::Dispatch},
+        {"codegen/vars=slots flow=blocks", VarStorage::Slots, ControlFlow::Blocks},
+        {"codegen/vars=map flow=structured", VarStorage::Map, ControlFlow::Structured},
+        {"codegen/vars=slots flow=structured", VarStorage::Slots, ControlFlow::Structured},
+        {"codegen/vars=locals flow=structured", VarStorage::Locals, ControlFlow::Structured},
+    };
+    for (const auto& m : kModes){
+        translator::CodegenOptions opts; opts.vars = m.vars; opts.flow = m.flow;
+        compile_and_time(m.name, translator::Codegen::emit_cpp(prog, opts), scale);
+    }
+
+    // Aynı tamsayı çekirdeği double ve std::int64_t değişkenlerle.
+    translator::Lexer ilx(make_int_kernel(scale));
+    translator::Parser ips(ilx);
+    const translator::Program iprog = ips.parseProgram();
+    const struct { const char* name; VarStorage vars; bool typed; } kTyped[] = {
+        {"codegen/int kernel vars=slots", VarStorage::Slots, false},
+        {"codegen/int kernel vars=slots typed", VarStorage::Slots, true},
+        {"codegen/int kernel vars=locals", VarStorage::Locals, false},
+        {"codegen/int kernel vars=locals typed", VarStorage::Locals, true},
+    };
+    for (const auto& m : kTyped){
+        translator::CodegenOptions opts; opts.vars = m.vars; opts.flow = ControlFlow::Structured; opts.typed = m.typed;
+        compile_and_time(m.name, translator::Codegen::emit_cpp(iprog, opts), scale);
+    }
+
+    // Aynı gövde FOR/NEXT ile: structured kipte doğal `for` döngüsü olur.
+    translator::Lexer flx(make_for_kernel(scale));
+    translator::Parser fps(flx);
+    const translator::Program fprog = fps.parseProgram();
+    const struct { const char* name; ControlFlow flow; bool typed; } kFor[] = {
+        {"codegen/for kernel vars=locals", ControlFlow::Dispatch, false},
+        {"codegen/for kernel flow=structured", ControlFlow::Structured, false},
+        {"codegen/for kernel structured typed", ControlFlow::Structured, true},
+    };
+    for (const auto& m : kFor){
+        translator::CodegenOptions opts; opts.vars = VarStorage::Locals; opts.flow = m.flow; opts.typed = m.typed;
+        compile_and_time(m.name, translator::Codegen::emit_cpp(fprog, opts), scale);
+    }
+}
+
+/**
+ * \brief Sayaç tabanlı dağıtımın deyim başına maliyetini ölçer.
+ *
+ * Gövde 32 düz deyimden oluşur; dispatch kipinde her deyim `switch`e
+ * geri döner, blocks ve structured kiplerinde blok içinde düz akar.
+ * \param scale Döngü tur sayısı
+ */
+void run_dispatch(int scale){
+    translator::Lexer lx(make_straight_kernel(scale, 32));
+    translator::Parser ps(lx);
+    const translator::Program prog = ps.parseProgram();
+    using translator::ControlFlow;
+    const struct { const char* name; ControlFlow flow; } kModes[] = {
+        {"dispatch/flow=dispatch", ControlFlow::Dispatch},
+        {"dispatch/flow=blocks", ControlFlow::Blocks},
+        {"dispatch/flow=structured", ControlFlow::Structured},
+    };
+    for (const auto& m : kModes){
+        translator::CodegenOptions opts; opts.vars = translator::VarStorage::Slots; opts.flow = m.flow;
+        compile_and_time(m.name, translator::Codegen::emit_cpp(prog, opts), scale);
+    }
+}
+
+} // namespace bench
@@ -0,0 +1,123 @@
+/**
+ * @file interp_bench.cpp
+ * @brief Yürütme yollarının deyim başına süre ölçümleri.
+ *
+ * Her iş yükü ağaç yürütücü yorumlayıcıda, bayt kodu VM'inde ve
+ * emit_cpp çıktısı derlenerek çalıştırılır. Çalıştırılan deyim sayısı
+ * yorumlayıcıdan alınır; üç yol da aynı sayıda deyim çalıştırır.
+ */
+#include "bench_common.h"
+#include <cstdint>
+#include <sstream>
+#include "translator/codegen.h"
+#include "translator/interpreter.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator/vm.h"
+
+namespace bench {
+
+namespace {
+
+/**
+ * \brief Sıkı döngü: her tur birkaç LET ve bir koşullu atlama.
+ * \param iters Döngü tur sayısı
+ */
+std::string make_loop_workload(int iters){
+    return "10 LET I = " + std::to_string(iters) + "\n"
+           "20 LET S = S + I\n"
+           "30 LET T = T + 1\n"
+           "40 LET I = I - 1\n"
+           "50 IF I THEN 20\n"
+           "60 PRINT S, T\n";
+}
+
+/**
+ * \brief GOSUB özyinelemesi: her tur 16 derinliğe inip geri döner.
+ * \param iters Dış döngü tur sayısı
+ */
+std::string make_gosub_workload(int iters){
+    return "10 LET R = " + std::to_string(iters / 16 + 1) + "\n"
+           "20 LET N = 16\n"
+           "30 GOSUB 100\n"
+           "40 LET R = R - 1\n"
+           "50 IF R THEN 20\n"
+           "60 PRINT D\n"
+           "70 GOTO 999\n"
+           "100 IF N THEN 120\n"
+           "110 RETURN\n"
+           "120 LET N = N - 1\n"
+           "130 LET D = D + 1\n"
+           "140 GOSUB 100\n"
+           "150 RETURN\n";
+}
+
+/**
+ * \brief Aritmetik ağırlıklı döngü: her deyimde uzun ifadeler.
+ * \param iters Döngü tur sayısı
+ */
+std::string make_arith_workload(int iters){
+    return "10 LET I = " + std::to_string(iters) + "\n"
+           "20 LET X = (X + I * 3 - 7) / 2 + (I * I - X) / (I + 1)\n"
+           "30 LET Y = Y / 2 + (X - I) * (X + I) / (I * I + 1) - 3 * X / 7\n"
+           "40 LET Z = (X + Y) * (X - Y) / ((X * X + Y * Y) + 1) + Z / 2\n"
+           "50 LET I = I - 1\n"
+           "60 IF I THEN 20\n"
+           "70 PRINT X, Y, Z\n";
+}
+
+/** \brief Deyim başına süreyi yazar. */
+void report_ns(const std::string& name, double seconds, std::uint64_t stmts){
+    std::printf("%-34s %10.3f ms  %10.2f ns/stmt\n", name.c_str(), seconds*1e3, seconds*1e9/static_cast<double>(stmts));
+}
+
+/**
+ * \brief Bir iş yükünü tüm yollarda çalıştırır.
+ * \param name İş yükü adı
+ * \param src BASIC kaynağı
+ */
+void run_workload(const std::string& name, const std::string& src){
+    translator::Lexer lx(src);
+    translator::Parser ps(lx);
+    const translator::Program prog = ps.parseProgram();
+
+    std::uint64_t stmts = 0;
+    {
+        translator::Interpreter interp(prog);
+        double t = best_of(3, [&]{ std::istringstream in; std::ostringstream out; stmts = interp.run(in, out); });
+        report_ns("interp/" + name + " tree", t, stmts);
+    }
+    {
+        translator::Bytecode bc = translator::compile_bytecode(prog);
+        translator::VM vm(bc);
+        double t = best_of(3, [&]{ std::istringstream in; std::ostringstream out; vm.run(in, out); });
+        report_ns("interp/" + name + " vm", t, stmts);
+    }
+    const struct { const char* name; translator::VarStorage vars; translator::ControlFlow flow; } kModes[] = {
+        {" cpp", translator::VarStorage::Map, translator::ControlFlow::Dispatch},
+        {" cpp slots+structured", translator::VarStorage::Slots, translator::ControlFlow::Structured},
+    };
+    for (const auto& m : kModes){
+        translator::CodegenOptions opts; opts.vars = m.vars; opts.flow = m.flow;
+        const std::string label = "interp/" + name + m.name;
+        double t = compile_and_run(label, translator::Codegen::emit_cpp(prog, opts));
+        if (t >= 0) report_ns(label, t, stmts);
+    }
+}
+
+} // namespace
+
+/**
+ * \brief Döngü, GOSUB özyinelemesi ve aritmetik iş yüklerinde deyim başına süreyi raporlar.
+ *
+ * Derlenmiş çıktının süresi süreç başlatmayı da içerir; küçük ölçeklerde
+ * baskın olabilir.
+ * \param scale İş yükü başına yaklaşık döngü tur sayısı
+ */
+void run_interp(int scale){
+    run_workload("loop", make_loop_workload(scale));
+    run_workload("gosub", make_gosub_workload(scale));
+    run_workload("arith", make_arith_workload(scale));
+}
+
+} // namespace bench
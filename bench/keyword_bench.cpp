@@ -0,0 +1,69 @@
+/**
+ * @file keyword_bench.cpp
+ * @brief Anahtar sözcük tanıma ölçümleri: if-else zinciri ve mükemmel özet tablosu.
+ */
+#include <string>
+#include <string_view>
+#include <vector>
+#include "bench_common.h"
+#include "translator/keywords.h"
+
+namespace bench {
+
+namespace {
+
+/**
+ * \brief Eski lexer'daki büyük harfe çevir-ve-karşılaştır zincirinin aynısı (karşılaştırma tabanı).
+ * \param id Tanımlayıcı
+ * \return Belirteç türü
+ */
+translator::TokenType chain_keyword_type(std::string_view id){
+    using translator::TokenType;
+    std::string up; up.reserve(id.size());
+    for (char ch : id) up.push_back(translator::detail::ascii_upper(ch));
+    if (up=="LET") return TokenType::KW_LET;
+    else if (up=="PRINT") return TokenType::KW_PRINT;
+    else if (up=="INPUT") return TokenType::KW_INPUT;
+    else if (up=="IF") return TokenType::KW_IF;
+    else if (up=="THEN") return TokenType::KW_THEN;
+    else if (up=="GOTO") return TokenType::KW_GOTO;
+    else if (up=="FOR") return TokenType::KW_FOR;
+    else if (up=="TO") return TokenType::KW_TO;
+    else if (up=="STEP") return TokenType::KW_STEP;
+    else if (up=="NEXT") return TokenType::KW_NEXT;
+    else if (up=="GOSUB") return TokenType::KW_GOSUB;
+    else if (up=="RETURN") return TokenType::KW_RETURN;
+    return TokenType::Identifier;
+}
+
+/**
+ * \brief Çoğunluğu tanımlayıcı, arada anahtar sözcük içeren bir sözcük listesi üretir.
+ * \param n Sözcük sayısı
+ */
+std::vector<std::string> make_word_corpus(int n){
+    static const char* const kWords[] = {
+        "counter", "TOTAL", "x", "Alpha_1", "BETA2", "gamma_three", "i", "LoopVar",
+        "print", "IF", "Then", "goto", "TEMPERATURE", "y1", "next", "RESULT_VALUE",
+    };
+    std::vector<std::string> out; out.reserve(static_cast<std::size_t>(n));
+    for (int i=0;i<n;++i) out.emplace_back(kWords[i % (sizeof(kWords)/sizeof(kWords[0]))]);
+    return out;
+}
+
+} // namespace
+
+/**
+ * \brief Her iki tanıyıcıyı aynı sözcük listesi üzerinde ölçer.
+ * \param scale Sözcük sayısı
+ */
+void run_keywords(int scale){
+    auto words = make_word_corpus(scale);
+    volatile int sink = 0;
+    double chain = best_of(5, [&]{ int k=0; for (const auto& w : words) k += chain_keyword_type(w) != translator::TokenType::Identifier; sink = k; });
+    report("keywords/if-else chain (baseline)", chain, static_cast<double>(words.size()), "words");
+    double table = best_of(5, [&]{ int k=0; for (const auto& w : words) k += translator::keyword_type(w) != translator::TokenType::Identifier; sink = k; });
+    report("keywords/perfect hash", table, static_cast<double>(words.size()), "words");
+    (void)sink;
+}
+
+} // namespace bench
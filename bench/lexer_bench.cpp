@@ -0,0 +1,30 @@
+/**
+ * @file lexer_bench.cpp
+ * @brief Lexer ölçümleri: sahiplenen, kopyasız ve akış tabanlı belirteç üretimi.
+ */
+#include "bench_common.h"
+#include <sstream>
+#include "translator/lexer.h"
+
+namespace bench {
+
+/**
+ * \brief tokenize(), tokenize_view() ve StreamLexer hızlarını belirteç/saniye olarak raporlar.
+ * \param scale Üretilecek satır sayısı
+ */
+void run_lexer(int scale){
+    translator::Lexer lx(make_basic_corpus(scale));
+    std::size_t count = 0;
+    double owned = best_of(5, [&]{ count = lx.tokenize().size(); });
+    report("lexer/tokenize (std::string)", owned, static_cast<double>(count), "tokens");
+    double views = best_of(5, [&]{ count = lx.tokenize_view().size(); });
+    report("lexer/tokenize_view (string_view)", views, static_cast<double>(count), "tokens");
+    const std::string corpus = make_basic_corpus(scale);
+    double stream = best_of(5, [&]{
+        std::istringstream in(corpus); translator::StreamLexer sl(in); count = 1;
+        while (sl.next().type != translator::TokenType::Eof) ++count;
+    });
+    report("lexer/StreamLexer::next (istream)", stream, static_cast<double>(count), "tokens");
+}
+
+} // namespace bench
@@ -0,0 +1,48 @@
+/**
+ * @file main.cpp
+ * @brief translator_bench giriş noktası: ölçüm gruplarını adlarıyla çalıştırır.
+ *
+ * Kullanım: translator_bench [grup|all] [ölçek]
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "bench_common.h"
+
+namespace {
+
+/** \brief Ada göre çalıştırılabilen ölçüm grubu. */
+struct Suite { const char* name; void (*run)(int); int default_scale; };
+
+/** \brief Kayıtlı ölçüm grupları. */
+const Suite kSuites[] = {
+    {"lexer", bench::run_lexer, 200000},
+    {"keywords", bench::run_keywords, 2000000},
+    {"scan", bench::run_scan, 100000},
+    {"parser", bench::run_parser, 1000000},
+    {"ast", bench::run_ast, 1000000},
+    {"codegen", bench::run_codegen, 20000000},
+    {"dispatch", bench::run_dispatch, 5000000},
+    {"interp", bench::run_interp, 1000000},
+};
+
+} // namespace
+
+int main(int argc, char** argv){
+    const char* which = argc > 1 ? argv[1] : "all";
+    int scale = argc > 2 ? std::atoi(argv[2]) : 0;
+    bool any = false;
+    for (const auto& s : kSuites){
+        if (std::strcmp(which, "all") != 0 && std::strcmp(which, s.name) != 0) continue;
+        std::printf("== %s ==\n", s.name);
+        s.run(scale > 0 ? scale : s.default_scale);
+        any = true;
+    }
+    if (!any){
+        std::fprintf(stderr, "Usage: translator_bench [all");
+        for (const auto& s : kSuites) std::fprintf(stderr, "|%s", s.name);
+        std::fprintf(stderr, "] [scale]\n");
+        return 1;
+    }
+    return 0;
+}
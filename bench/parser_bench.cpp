@@ -0,0 +1,116 @@
+/**
+ * @file parser_bench.cpp
+ * @brief Parser ölçümleri: AST kurma, Program yıkım maliyeti, sayı çevirme ve iç içe ifade derinliği.
+ */
+#include "bench_common.h"
+#include <algorithm>
+#include <charconv>
+#include <memory>
+#include <string>
+#include "translator/lexer.h"
+#include "translator/parser.h"
+
+namespace bench {
+
+namespace {
+
+/**
+ * \brief Sayı yoğun BASIC kaynağı üretir: her deyimde tamsayı, ondalık ve üslü literaller.
+ * \param n Deyim sayısı
+ */
+std::string make_number_corpus(int n){
+    std::string s;
+    s.reserve(static_cast<std::size_t>(n) * 64);
+    for (int i=0;i<n;++i){
+        const int k = i % 997;
+        s += std::to_string((i+1)*10) + " LET X = " + std::to_string(k) + " + " + std::to_string(k) + ".25 * 1.5e"
+           + std::to_string(k % 7) + " - ." + std::to_string(k + 1) + " / 2.75E-3\n";
+    }
+    return s;
+}
+
+/**
+ * \brief Tek deyimlik, `depth` kat iç içe parantezli ifade üretir.
+ * \param depth Parantez derinliği
+ *
+ * Her düzey `A + (B * -(...)) < 1` biçimindedir; böylece her öncelik
+ * düzeyi ve tekli eksi de derinlikle birlikte yığılır.
+ */
+std::string make_nested_corpus(int depth){
+    std::string s = "10 IF ";
+    s.reserve(static_cast<std::size_t>(depth) * 16 + 32);
+    for (int i=0;i<depth;++i) s += "A + (B * -(";
+    s += "C";
+    for (int i=0;i<depth;++i) s += ")) < 1";
+    s += " THEN 10\n";
+    return s;
+}
+
+} // namespace
+
+/**
+ * \brief Önceden üretilmiş belirteçlerden Program kurma ve yok etme sürelerini ayrı ayrı raporlar.
+ * \param scale Üretilecek deyim sayısı
+ */
+void run_parser(int scale){
+    translator::Lexer lx(make_basic_corpus(scale));
+    const auto toks = lx.tokenize_view();
+    std::unique_ptr<translator::Program> prog;
+    double parse = best_of(5, [&]{
+        prog.reset();
+        translator::Parser ps(toks);
+        prog = std::make_unique<translator::Program>(ps.parseProgram());
+    });
+    report("parser/parseProgram", parse, static_cast<double>(prog->stmts.size()), "stmts");
+    std::printf("%-34s %10.1f MiB in %zu blocks\n", "parser/arena", prog->arena->bytes_used() / 1048576.0, prog->arena->block_count());
+    double teardown = 1e300;
+    for (int r=0;r<5;++r){
+        translator::Parser ps(toks);
+        prog = std::make_unique<translator::Program>(ps.parseProgram());
+        teardown = std::min(teardown, best_of(1, [&]{ prog.reset(); }));
+    }
+    report("parser/~Program", teardown, static_cast<double>(scale), "stmts");
+
+    translator::Lexer nlx(make_number_corpus(scale));
+    const auto ntoks = nlx.tokenize_view();
+    double dense = best_of(5, [&]{
+        prog.reset();
+        translator::Parser ps(ntoks);
+        prog = std::make_unique<translator::Program>(ps.parseProgram());
+    });
+    report("parser/parseProgram (number-dense)", dense, static_cast<double>(prog->stmts.size()), "stmts");
+
+    // Aynı lexemeler üzerinde eski (kopya + stod) ve yeni (from_chars) çevirme.
+    std::size_t nums = 0;
+    for (const auto& t : ntoks) nums += t.type == translator::TokenType::Number;
+    volatile double sink = 0;
+    double stod = best_of(5, [&]{
+        double acc = 0;
+        for (const auto& t : ntoks) if (t.type == translator::TokenType::Number) acc += std::stod(std::string(t.lexeme));
+        sink = acc;
+    });
+    report("parser/number std::stod", stod, static_cast<double>(nums), "numbers");
+    double fc = best_of(5, [&]{
+        double acc = 0;
+        for (const auto& t : ntoks) if (t.type == translator::TokenType::Number){
+            double v = 0; std::from_chars(t.lexeme.data(), t.lexeme.data() + t.lexeme.size(), v); acc += v;
+        }
+        sink = acc;
+    });
+    report("parser/number std::from_chars", fc, static_cast<double>(nums), "numbers");
+    (void)sink;
+
+    // Parantez derinliği yalnızca açık yığınları büyütür; özyinelemeli
+    // çözümleyici bu derinlikte çağrı yığınını taşırırdı.
+    const int depth = 1 << 18;
+    translator::Lexer dlx(make_nested_corpus(depth));
+    const auto dtoks = dlx.tokenize_view();
+    double nested = best_of(5, [&]{
+        prog.reset();
+        translator::Parser ps(dtoks);
+        prog = std::make_unique<translator::Program>(ps.parseProgram());
+    });
+    report("parser/parseProgram (nesting depth 262144)", nested, static_cast<double>(dtoks.size()), "tokens");
+}
+
+} // namespace bench
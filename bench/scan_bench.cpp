@@ -0,0 +1,40 @@
+/**
+ * @file scan_bench.cpp
+ * @brief Lexer tarama çekirdeklerinin komut kümelerine göre ölçümü.
+ */
+#include <string>
+#include "bench_common.h"
+#include "translator/lexer.h"
+#include "translator/scan.h"
+
+namespace bench {
+
+/**
+ * \brief Uzun tanımlayıcı, sayı ve dize içeren girdi üzerinde her komut kümesini ölçer.
+ * \param scale Satır sayısı
+ */
+void run_scan(int scale){
+    std::string src; src.reserve(static_cast<std::size_t>(scale) * 96);
+    for (int i=0;i<scale;++i){
+        src += std::to_string((i+1)*10);
+        src += " PRINT \"the quick brown fox jumps over the lazy dog\", VERY_LONG_IDENTIFIER_NAME_";
+        src += std::to_string(i % 97); src += " * 12345678901234567890\n";
+    }
+    translator::Lexer lx(src);
+    const translator::scan::Isa prev = translator::scan::active().isa;
+    static const struct { translator::scan::Isa isa; const char* name; } kIsas[] = {
+        {translator::scan::Isa::Scalar, "scan/scalar table"},
+        {translator::scan::Isa::SSE2, "scan/sse2"},
+        {translator::scan::Isa::AVX2, "scan/avx2"},
+    };
+    for (const auto& e : kIsas){
+        if (!translator::scan::select(e.isa)) { std::printf("%-34s (desteklenmiyor)\n", e.name); continue; }
+        std::size_t count = 0;
+        double t = best_of(5, [&]{ count = lx.tokenize_view().size(); });
+        report(e.name, t, static_cast<double>(src.size()), "bytes");
+        (void)count;
+    }
+    translator::scan::select(prev);
+}
+
+} // namespace bench
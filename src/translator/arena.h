@@ -0,0 +1,122 @@
+/**
+ * @file arena.h
+ * @brief AST düğümleri için bölge (bump) bellek ayırıcısı
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace translator {
+
+/**
+ * @brief Bloklar halinde büyüyen, tek seferde serbest bırakılan bellek bölgesi
+ * 
+ * Ayırma yalnızca bir işaretçi ilerletmesidir. Tek tek serbest bırakma
+ * yoktur: bölge yok edildiğinde tüm bloklar birlikte bırakılır. Bu nedenle
+ * yalnızca yıkıcısı önemsiz (trivially destructible) türler yerleştirilebilir.
+ */
+class Arena {
+    std::vector<std::unique_ptr<char[]>> blocks_;  ///< Sahip olunan bloklar
+    char* cur_ = nullptr;                          ///< Geçerli bloktaki boş alanın başı
+    char* end_ = nullptr;                          ///< Geçerli bloğun sonu
+    std::size_t next_block_ = 64 * 1024;           ///< Bir sonraki bloğun boyutu
+    std::size_t used_ = 0;                         ///< Ayrılan toplam bayt
+
+    /**
+     * @brief En az `size + align` bayt boş alanı olan yeni bir blok açar
+     * @param size İstenen boyut
+     * @param align İstenen hizalama
+     */
+    void grow(std::size_t size, std::size_t align){
+        std::size_t want = size + align;
+        std::size_t bytes = next_block_ > want ? next_block_ : want;
+        blocks_.emplace_back(new char[bytes]);
+        cur_ = blocks_.back().get(); end_ = cur_ + bytes;
+        if (next_block_ < (std::size_t(1) << 24)) next_block_ *= 2;
+    }
+
+public:
+    Arena() = default;
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Hizalanmış ham bellek ayırır
+     * @param size Boyut (bayt)
+     * @param align Hizalama (2'nin kuvveti)
+     * @return Bölge yaşadığı sürece geçerli bellek
+     */
+    void* allocate(std::size_t size, std::size_t align){
+        std::size_t pad = (align - reinterpret_cast<std::uintptr_t>(cur_) % align) % align;
+        if (!cur_ || static_cast<std::size_t>(end_ - cur_) < pad + size){ grow(size, align); pad = (align - reinterpret_cast<std::uintptr_t>(cur_) % align) % align; }
+        char* p = cur_ + pad;
+        cur_ = p + size; used_ += size;
+        return p;
+    }
+
+    /**
+     * @brief Bölge içinde bir nesne oluşturur
+     * @tparam T Yıkıcısı önemsiz tür
+     * @param args Kurucu argümanları
+     * @return Oluşturulan nesne
+     */
+    template <typename T, typename... Args>
+    T* make(Args&&... args){
+        static_assert(std::is_trivially_destructible<T>::value, "Arena yalnızca yıkıcısı önemsiz türleri tutar");
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Bir diziyi bölgeye kopyalar
+     * @param src Kaynak dizi
+     * @param n Eleman sayısı
+     * @return Bölgedeki kopyanın başı (n == 0 ise nullptr)
+     */
+    template <typename T>
+    T* copy_array(const T* src, std::size_t n){
+        static_assert(std::is_trivially_copyable<T>::value, "copy_array önemsiz kopyalanabilir tür bekler");
+        if (n == 0) return nullptr;
+        T* dst = static_cast<T*>(allocate(sizeof(T) * n, alignof(T)));
+        std::memcpy(dst, src, sizeof(T) * n);
+        return dst;
+    }
+
+    /**
+     * @brief Metni bölgeye kopyalar
+     * @param s Kaynak metin
+     * @return Bölgedeki kopyaya görünüm
+     */
+    std::string_view copy(std::string_view s){
+        return std::string_view(copy_array(s.data(), s.size()), s.size());
+    }
+
+    /**
+     * @brief Tüm ayırmaları geçersiz kılıp bölgeyi yeniden kullanıma hazırlar
+     *
+     * En büyük (son) blok tutulur, diğerleri bırakılır; böylece aynı boyda
+     * ayırmalar tekrarlandığında yeni blok açılmaz.
+     */
+    void reset() noexcept {
+        if (blocks_.empty()) return;
+        if (blocks_.size() > 1){ std::unique_ptr<char[]> last = std::move(blocks_.back()); blocks_.clear(); blocks_.push_back(std::move(last)); }
+        cur_ = blocks_.back().get();
+        used_ = 0;
+    }
+
+    /** @brief Şimdiye kadar ayrılan bayt sayısı. */
+    std::size_t bytes_used() const noexcept { return used_; }
+    /** @brief Sahip olunan blok sayısı. */
+    std::size_t block_count() const noexcept { return blocks_.size(); }
+};
+
+} // namespace translator
@@ -6,9 +6,13 @@
  * @version 1.0
  */
 #pragma once
+#include <cstddef>
 #include <memory>
-#include <string>
+#include <string_view>
 #include <vector>
+#include "translator/arena.h"
+#include "translator/interner.h"
+#include "translator/label_index.h"
 
 namespace translator {
 
@@ -24,15 +28,36 @@ enum class ExprKind {
 /**
  * @brief Tüm ifade türleri için taban tür
  * 
- * Abstract Syntax Tree'deki tüm ifadeler bu sınıftan türetilir.
+ * Abstract Syntax Tree'deki tüm ifadeler bu sınıftan türetilir. Düğümler
+ * Program'ın bölgesinde (Arena) yaşar; sanal tablo ve yıkıcı yoktur,
+ * tür bilgisi düğümün içinde saklanır.
  */
 struct Expr {
-    virtual ~Expr() = default;
     /**
      * @brief İfade türünü döndürür
      * @return İfade türü
      */
-    virtual ExprKind kind() const = 0;
+    ExprKind kind() const { return kind_; }
+protected:
+    explicit Expr(ExprKind k) : kind_(k) {}
+private:
+    ExprKind kind_;  ///< Düğüm türü
+};
+
+/**
+ * @brief Bölgede saklanan salt okunur düğüm dizisi
+ * @tparam T Düğüm türü
+ */
+template <typename T>
+struct NodeList {
+    T* const* data = nullptr;  ///< Bölgedeki işaretçi dizisi
+    std::size_t count = 0;     ///< Eleman sayısı
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    T* operator[](std::size_t i) const { return data[i]; }
+    T* const* begin() const { return data; }
+    T* const* end() const { return data + count; }
 };
 
 /**
@@ -45,41 +70,36 @@ struct NumberExpr : Expr {
      * @brief Sayısal sabit oluşturur
      * @param v Sayısal değer
      */
-    explicit NumberExpr(double v) : value(v) {}
-    
-    /**
-     * @brief İfade türünü döndürür
-     * @return Number türü
-     */
-    ExprKind kind() const override { return ExprKind::Number; }
+    explicit NumberExpr(double v) : Expr(ExprKind::Number), value(v) {}
 };
 
 /**
  * @brief Değişken ifadesi
  */
 struct VariableExpr : Expr {
-    std::string name;  ///< Değişken adı
+    SymbolId id;            ///< Değişken kimliği (Program::symbols)
+    std::string_view name;  ///< Değişken adı (Program::symbols içindeki görünüm)
     
     /**
      * @brief Değişken ifadesi oluşturur
-     * @param n Değişken adı
+     * @param id Değişken kimliği
+     * @param n Değişken adı; Program yaşadığı sürece geçerli olmalıdır
      */
-    explicit VariableExpr(std::string n) : name(std::move(n)) {}
-    
-    /**
-     * @brief İfade türünü döndürür
-     * @return Variable türü
-     */
-    ExprKind kind() const override { return ExprKind::Variable; }
+    VariableExpr(SymbolId id, std::string_view n) : Expr(ExprKind::Variable), id(id), name(n) {}
 };
 
 /**
  * @brief İkili işlem ifadesi
+ *
+ * Operatörler tek karakterle tutulur: `+ - * /`, karşılaştırmalar için
+ * `< > =` ve iki karakterli olanlar için 'L' (<=), 'G' (>=), 'N' (<>).
+ * Karşılaştırmaların değeri doğruysa 1, yanlışsa 0'dır. Tekli eksi
+ * `0 - x` olarak gösterilir.
  */
 struct BinaryExpr : Expr {
-    char op;                        ///< İşlem operatörü
-    std::unique_ptr<Expr> lhs;      ///< Sol operand
-    std::unique_ptr<Expr> rhs;      ///< Sağ operand
+    char op;      ///< İşlem operatörü
+    Expr* lhs;    ///< Sol operand
+    Expr* rhs;    ///< Sağ operand
     
     /**
      * @brief İkili işlem ifadesi oluşturur
@@ -87,14 +107,8 @@ struct BinaryExpr : Expr {
      * @param l Sol operand
      * @param r Sağ operand
      */
-    BinaryExpr(char op, std::unique_ptr<Expr> l, std::unique_ptr<Expr> r)
-        : op(op), lhs(std::move(l)), rhs(std::move(r)) {}
-    
-    /**
-     * @brief İfade türünü döndürür
-     * @return Binary türü
-     */
-    ExprKind kind() const override { return ExprKind::Binary; }
+    BinaryExpr(char op, Expr* l, Expr* r)
+        : Expr(ExprKind::Binary), op(op), lhs(l), rhs(r) {}
 };
 
 /**
@@ -107,81 +121,72 @@ enum class StmtKind {
     Goto,       ///< Atlama deyimi
     IfGoto,     ///< Koşullu atlama deyimi
     Gosub,      ///< Alt program çağırma deyimi
-    Return      ///< Alt programdan dönüş deyimi
+    Return,     ///< Alt programdan dönüş deyimi
+    For,        ///< Döngü başı (FOR ... TO ... STEP)
+    Next        ///< Döngü sonu (NEXT)
 };
 
 /**
  * @brief Tüm deyimler için taban tür
  * 
  * Abstract Syntax Tree'deki tüm deyimler bu sınıftan türetilir.
+ * İfadeler gibi deyimler de Program'ın bölgesinde yaşar.
  */
 struct Stmt { 
-    virtual ~Stmt() = default; 
-    
     /**
      * @brief Deyim türünü döndürür
      * @return Deyim türü
      */
-    virtual StmtKind kind() const = 0; 
+    StmtKind kind() const { return kind_; }
+protected:
+    explicit Stmt(StmtKind k) : kind_(k) {}
+private:
+    StmtKind kind_;  ///< Düğüm türü
 };
 
 /**
  * @brief LET atama deyimi
  */
 struct LetStmt : Stmt {
-    std::string name;                    ///< Değişken adı
-    std::unique_ptr<Expr> expr;          ///< Atanacak ifade
+    SymbolId id;             ///< Değişken kimliği
+    std::string_view name;   ///< Değişken adı
+    Expr* expr;              ///< Atanacak ifade
     
     /**
      * @brief Atama deyimi oluşturur
+     * @param id Değişken kimliği
      * @param n Değişken adı
      * @param e Atanacak ifade
      */
-    LetStmt(std::string n, std::unique_ptr<Expr> e) : name(std::move(n)), expr(std::move(e)) {}
-    
-    /**
-     * @brief Deyim türünü döndürür
-     * @return Let türü
-     */
-    StmtKind kind() const override { return StmtKind::Let; }
+    LetStmt(SymbolId id, std::string_view n, Expr* e) : Stmt(StmtKind::Let), id(id), name(n), expr(e) {}
 };
 
 /**
  * @brief PRINT deyimi
  */
 struct PrintStmt : Stmt {
-    std::vector<std::unique_ptr<Expr>> items;  ///< Yazdırılacak ifadeler
+    NodeList<Expr> items;  ///< Yazdırılacak ifadeler
     
     /**
      * @brief Yazdırma deyimi oluşturur
-     * @param xs Yazdırılacak ifadeler
+     * @param xs Yazdırılacak ifadeler (bölgedeki dizi)
      */
-    explicit PrintStmt(std::vector<std::unique_ptr<Expr>> xs) : items(std::move(xs)) {}
-    
-    /**
-     * @brief Deyim türünü döndürür
-     * @return Print türü
-     */
-    StmtKind kind() const override { return StmtKind::Print; }
+    explicit PrintStmt(NodeList<Expr> xs) : Stmt(StmtKind::Print), items(xs) {}
 };
 
 /**
  * @brief INPUT deyimi
  */
 struct InputStmt : Stmt {
-    std::string name;  ///< Giriş alınacak değişken adı
+    SymbolId id;            ///< Giriş alınacak değişkenin kimliği
+    std::string_view name;  ///< Giriş alınacak değişken adı
     
     /**
      * @brief Giriş deyimi oluşturur
+     * @param id Değişken kimliği
      * @param n Değişken adı
      */
-    explicit InputStmt(std::string n) : name(std::move(n)) {}
-    
-    /**
-     * @brief Deyim türünü döndürür
-     * @return Input türü
-     */
-    StmtKind kind() const override { return StmtKind::Input; }
+    InputStmt(SymbolId id, std::string_view n) : Stmt(StmtKind::Input), id(id), name(n) {}
 };
 
 /**
@@ -194,34 +199,22 @@ struct GotoStmt : Stmt {
      * @brief Atlama deyimi oluşturur
      * @param t Hedef satır numarası
      */
-    explicit GotoStmt(int t) : target(t) {}
-    
-    /**
-     * @brief Deyim türünü döndürür
-     * @return Goto türü
-     */
-    StmtKind kind() const override { return StmtKind::Goto; }
+    explicit GotoStmt(int t) : Stmt(StmtKind::Goto), target(t) {}
 };
 
 /**
  * @brief IF THEN GOTO deyimi
  */
 struct IfGotoStmt : Stmt {
-    std::unique_ptr<Expr> cond;  ///< Koşul ifadesi
-    int target;                  ///< Hedef satır numarası
+    Expr* cond;   ///< Koşul ifadesi
+    int target;   ///< Hedef satır numarası
     
     /**
      * @brief Koşullu atlama deyimi oluşturur
      * @param c Koşul ifadesi
      * @param t Hedef satır numarası
      */
-    IfGotoStmt(std::unique_ptr<Expr> c, int t) : cond(std::move(c)), target(t) {}
-    
-    /**
-     * @brief Deyim türünü döndürür
-     * @return IfGoto türü
-     */
-    StmtKind kind() const override { return StmtKind::IfGoto; }
+    IfGotoStmt(Expr* c, int t) : Stmt(StmtKind::IfGoto), cond(c), target(t) {}
 };
 
 /**
@@ -234,35 +227,80 @@ struct GosubStmt : Stmt {
      * @brief Alt program çağırma deyimi oluşturur
      * @param t Hedef satır numarası
      */
-    explicit GosubStmt(int t) : target(t) {}
-    
-    /**
-     * @brief Deyim türünü döndürür
-     * @return Gosub türü
-     */
-    StmtKind kind() const override { return StmtKind::Gosub; }
+    explicit GosubStmt(int t) : Stmt(StmtKind::Gosub), target(t) {}
 };
 
 /**
  * @brief RETURN deyimi
  */
 struct ReturnStmt : Stmt {
+    ReturnStmt() : Stmt(StmtKind::Return) {}
+};
+
+/**
+ * @brief FOR deyimi
+ *
+ * Sınır ve adım döngü girişinde bir kez hesaplanır, ardından değişkene
+ * başlangıç değeri atanır. Değişken sınırı adımın yönünde aşmışsa döngü
+ * hiç çalışmadan `exit` etiketine geçilir.
+ */
+struct ForStmt : Stmt {
+    SymbolId id;            ///< Döngü değişkeninin kimliği
+    std::string_view name;  ///< Döngü değişkeninin adı
+    Expr* start;            ///< Başlangıç değeri
+    Expr* limit;            ///< Sınır (TO)
+    Expr* step;             ///< Adım (STEP); yazılmadıysa nullptr, yani 1
+    int exit = -1;          ///< Eşleşen NEXT'ten sonraki deyimin etiketi; yoksa (ya da parse_each'te) -1
+
     /**
-     * @brief Deyim türünü döndürür
-     * @return Return türü
+     * @brief Döngü başı oluşturur
+     * @param id Değişken kimliği
+     * @param n Değişken adı
+     * @param start Başlangıç değeri
+     * @param limit Sınır
+     * @param step Adım; nullptr ise 1
+     */
+    ForStmt(SymbolId id, std::string_view n, Expr* start, Expr* limit, Expr* step)
+        : Stmt(StmtKind::For), id(id), name(n), start(start), limit(limit), step(step) {}
+};
+
+/**
+ * @brief NEXT deyimi
+ *
+ * Değişkene adımı ekler; sınır aşılmadıysa `body` etiketine döner.
+ * Eşleşme sözdizimseldir: her NEXT, kaynakta kendinden önceki en içteki
+ * kapanmamış FOR'u kapatır.
+ */
+struct NextStmt : Stmt {
+    SymbolId id;            ///< Döngü değişkeninin kimliği (NEXT'te yazılmadıysa FOR'unki)
+    std::string_view name;  ///< Döngü değişkeninin adı
+    int body = -1;          ///< Eşleşen FOR'dan sonraki deyimin etiketi; döngünün kimliğidir
+
+    /**
+     * @brief Döngü sonu oluşturur
+     * @param id Değişken kimliği
+     * @param n Değişken adı
      */
-    StmtKind kind() const override { return StmtKind::Return; }
+    NextStmt(SymbolId id, std::string_view n) : Stmt(StmtKind::Next), id(id), name(n) {}
 };
 
 /**
  * @brief Etiketlenmiş deyimlerden oluşan program
  * 
  * Program, paralel diziler kullanarak etiket-deyim çiftlerini tutar.
+ * Tüm düğümler `arena` içinde yaşar ve Program ile birlikte tek seferde
+ * serbest bırakılır; bölge yığında tutulduğu için Program taşındığında
+ * düğüm işaretçileri geçerli kalır. Değişken adları `symbols` içinde
+ * tekilleştirilir ve düğümlerde kimlikleriyle birlikte tutulur. Atlama
+ * hedefleri `index` üzerinden sabit zamanda çözülür; elle kurulan ya da
+ * düzenlenen programlarda `index` labels ile uyuşmuyorsa yok sayılır.
  */
 struct Program {
     std::vector<int> labels;                      ///< Satır etiketleri (örn: 10, 20, 30)
-    std::vector<std::unique_ptr<Stmt>> stmts;     ///< Her etikete karşılık gelen deyimler
-    // Label -> index map will be provided via lookup helper.
+    std::vector<Stmt*> stmts;                     ///< Her etikete karşılık gelen deyimler
+    std::unique_ptr<Arena> arena = std::make_unique<Arena>();  ///< Düğümlerin sahibi
+    Interner symbols;                             ///< Değişken adı ↔ kimlik tablosu
+    LabelIndex index;                             ///< Etiket → deyim indeksi; parseProgram() kurar, bayatsa kullananlar labels'tan yeniden kurar
 };
 
 } // namespace translator
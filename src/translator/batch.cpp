@@ -0,0 +1,172 @@
+/**
+ * @file batch.cpp
+ * @brief Paralel çoklu dosya çevirisi uygulaması.
+ */
+#include "translator/batch.h"
+#include "translator/codegen.h"
+#include "translator/emitter.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+namespace translator {
+
+/**
+ * \brief Dosyayı yükler ve çözümler; sözdizim hataları için istisna fırlatmaz.
+ * \param path Girdi dosyası
+ * \param mode Girdi yükleme biçimi
+ * \param bytes_in Okunan girdi boyutu (isteğe bağlı)
+ * \param[out] res Çözümleme sonucu
+ * \return Hata yoksa true
+ */
+static bool parse_source(const std::string& path, SourceMode mode, std::size_t* bytes_in, ParseResult& res){
+    auto source = SourceBuffer::open(path, mode);
+    if (bytes_in) *bytes_in = source.view().size();
+    Lexer lexer(source);
+    Parser parser(lexer);
+    res = parser.parse();
+    return res.ok();
+}
+
+/**
+ * \brief Dosyayı yükler, çözümler ve C++ koduna çevirir.
+ * \param path Girdi dosyası
+ * \param mode Girdi yükleme biçimi
+ * \param bytes_in Okunan girdi boyutu (isteğe bağlı)
+ * \param opts Kod üretimi seçenekleri
+ * \return Üretilen C++ kodu
+ */
+std::string translate_file(const std::string& path, SourceMode mode, std::size_t* bytes_in, const CodegenOptions& opts){
+    ParseResult res;
+    if (!parse_source(path, mode, bytes_in, res)) throw std::runtime_error(res.errors.front().message);
+    return Codegen::emit_cpp(res.program, opts);
+}
+
+/**
+ * \brief Dizinleri ve manifestleri açarak girdi listesini üretir.
+ * \param args Komut satırı girdileri
+ * \return Girdi yolları
+ */
+std::vector<std::string> expand_inputs(const std::vector<std::string>& args){
+    std::vector<std::string> out;
+    for (const auto& a : args){
+        if (!a.empty() && a[0]=='@'){
+            std::ifstream in(a.substr(1));
+            if (!in) throw std::runtime_error("Cannot open manifest: " + a.substr(1));
+            std::string line;
+            while (std::getline(in, line)){
+                if (!line.empty() && line.back()=='\r') line.pop_back();
+                if (line.empty() || line[0]=='#') continue;
+                out.push_back(line);
+            }
+            continue;
+        }
+        std::error_code ec;
+        if (fs::is_directory(a, ec)){
+            std::vector<std::string> found;
+            for (const auto& e : fs::directory_iterator(a, ec)){
+                if (e.is_regular_file(ec) && e.path().extension() == ".bas") found.push_back(e.path().string());
+            }
+            std::sort(found.begin(), found.end());
+            out.insert(out.end(), found.begin(), found.end());
+            continue;
+        }
+        out.push_back(a);
+    }
+    return out;
+}
+
+/**
+ * \brief Girdi yolundan .cpp çıktı yolunu türetir.
+ * \param input Girdi yolu
+ * \param out_dir Çıktı dizini (boşsa girdinin dizini)
+ * \return Çıktı yolu
+ */
+std::string output_path_for(const std::string& input, const std::string& out_dir){
+    fs::path p(input);
+    p.replace_extension(".cpp");
+    if (!out_dir.empty()) p = fs::path(out_dir) / p.filename();
+    return p.string();
+}
+
+/**
+ * \brief Aynı çıktıya yazan iki iş varsa hata fırlatır.
+ * \param jobs Çeviri işleri
+ */
+void check_unique_outputs(const std::vector<BatchJob>& jobs){
+    std::unordered_map<std::string, std::size_t> seen;
+    seen.reserve(jobs.size());
+    for (std::size_t i = 0; i < jobs.size(); ++i){
+        auto [it, fresh] = seen.emplace(fs::path(jobs[i].output).lexically_normal().string(), i);
+        if (!fresh)
+            throw std::runtime_error("Output collision: " + jobs[it->second].input + " and " + jobs[i].input + " both write " + jobs[i].output);
+    }
+}
+
+/**
+ * \brief Tek bir işi çalıştırır; tüm hataları sonuç içine alır.
+ * \param job Çeviri işi
+ * \param mode Girdi yükleme biçimi
+ * \param opts Kod üretimi seçenekleri
+ * \return İş sonucu
+ */
+static BatchResult run_job(const BatchJob& job, SourceMode mode, const CodegenOptions& opts){
+    BatchResult r;
+    auto t0 = std::chrono::steady_clock::now();
+    try {
+        ParseResult res;
+        if (!parse_source(job.input, mode, &r.bytes_in, res)) {
+            r.error = res.errors.front().message;
+            r.diagnostics = std::move(res.errors);
+            r.millis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+            return r;
+        }
+        // Kod bellekte birikmeden parça parça çıktı dosyasına yazılır.
+        Emitter out = Emitter::open(job.output);
+        Codegen::emit_cpp(res.program, opts, out);
+        if (!out.flush()) throw std::runtime_error("Cannot write output: " + job.output);
+        r.bytes_out = out.size();
+        r.ok = true;
+    } catch (const std::exception& e) {
+        r.error = e.what();
+    }
+    r.millis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    return r;
+}
+
+/**
+ * \brief İşleri ortak bir sayaçtan çeken iş parçacıklarıyla çalıştırır.
+ *
+ * Her sonuç kendi indeksine yazıldığından çıktı sırası, zamanlamadan
+ * bağımsız olarak girdi sırasıyla aynıdır.
+ * \param jobs Çeviri işleri
+ * \param threads İş parçacığı sayısı (0: donanım çekirdek sayısı)
+ * \param mode Girdi yükleme biçimi
+ * \param opts Kod üretimi seçenekleri
+ * \return Girdi sırasıyla sonuçlar
+ */
+std::vector<BatchResult> run_batch(const std::vector<BatchJob>& jobs, unsigned threads, SourceMode mode, const CodegenOptions& opts){
+    std::vector<BatchResult> results(jobs.size());
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, jobs.size()));
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]{
+        for (std::size_t i = next.fetch_add(1); i < jobs.size(); i = next.fetch_add(1)) results[i] = run_job(jobs[i], mode, opts);
+    };
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& th : pool) th.join();
+    return results;
+}
+
+} // namespace translator
@@ -0,0 +1,87 @@
+/**
+ * @file batch.h
+ * @brief Çok dosyalı, iş parçacığı havuzu üzerinde paralel çeviri
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "translator/codegen.h"
+#include "translator/parser.h"
+#include "translator/source.h"
+
+namespace translator {
+
+/**
+ * @brief Tek bir çeviri işi
+ */
+struct BatchJob {
+    std::string input;   ///< Girdi .bas dosyası
+    std::string output;  ///< Üretilecek .cpp dosyası
+};
+
+/**
+ * @brief Bir işin sonucu
+ */
+struct BatchResult {
+    bool ok = false;            ///< Çeviri ve yazma başarılı mı?
+    std::string error;          ///< Hata iletisi (ok == false ise); sözdizim hatalarında ilkinin iletisi
+    std::vector<Diagnostic> diagnostics;  ///< Dosyadaki tüm sözdizim hataları
+    double millis = 0.0;        ///< Lex → parse → emit_cpp → yazma süresi (ms)
+    std::size_t bytes_in = 0;   ///< Girdi boyutu
+    std::size_t bytes_out = 0;  ///< Üretilen kod boyutu
+};
+
+/**
+ * @brief Tek bir dosyayı C++ koduna çevirir
+ * @param path Girdi dosyası ("-" standart girdi)
+ * @param mode Girdi yükleme biçimi
+ * @param bytes_in Okunan girdi boyutu (isteğe bağlı çıktı)
+ * @param opts Kod üretimi seçenekleri
+ * @return Üretilen C++ kaynak kodu
+ * @throws std::runtime_error girdi okunamaz ya da çözümlenemezse
+ */
+std::string translate_file(const std::string& path, SourceMode mode = SourceMode::Auto, std::size_t* bytes_in = nullptr, const CodegenOptions& opts = {});
+
+/**
+ * @brief Komut satırı girdilerini dosya listesine açar
+ * @param args Dosyalar, dizinler (içindeki *.bas dosyaları) ve @manifest
+ *             dosyaları (her satırda bir yol; boş ve '#' ile başlayan satırlar atlanır)
+ * @return Verilen sırayla, dizin içerikleri ada göre sıralı yol listesi
+ * @throws std::runtime_error manifest okunamazsa
+ */
+std::vector<std::string> expand_inputs(const std::vector<std::string>& args);
+
+/**
+ * @brief Girdi için çıktı yolunu belirler
+ * @param input Girdi yolu
+ * @param out_dir Çıktı dizini; boşsa girdinin yanına yazılır
+ * @return Uzantısı .cpp olan çıktı yolu
+ */
+std::string output_path_for(const std::string& input, const std::string& out_dir);
+
+/**
+ * @brief İki işin aynı çıktı dosyasına yazmadığını doğrular
+ * @param jobs Çeviri işleri
+ * @throws std::runtime_error iki iş aynı (normalleştirilmiş) çıktı yolunu
+ *         kullanıyorsa; ileti iki girdiyi ve ortak çıktıyı adlandırır
+ *
+ * Farklı dizinlerdeki aynı adlı girdiler `-o` altında aynı dosyaya düşer;
+ * paralel işler o dosyada yarışacağından çeviri başlamadan reddedilir.
+ */
+void check_unique_outputs(const std::vector<BatchJob>& jobs);
+
+/**
+ * @brief İşleri bir iş parçacığı havuzunda paralel olarak çalıştırır
+ * @param jobs Çeviri işleri
+ * @param threads İş parçacığı sayısı (0: donanım çekirdek sayısı)
+ * @param mode Girdi yükleme biçimi
+ * @param opts Kod üretimi seçenekleri
+ * @return jobs ile aynı sırada sonuçlar; hatalar istisna olarak sızmaz
+ */
+std::vector<BatchResult> run_batch(const std::vector<BatchJob>& jobs, unsigned threads = 0, SourceMode mode = SourceMode::Auto, const CodegenOptions& opts = {});
+
+} // namespace translator
@@ -8,7 +8,8 @@
 #pragma once
 #include "ds/graph.h"
 #include "translator/ast.h"
-#include <unordered_map>
+#include "translator/flat_ast.h"
+#include "translator/label_index.h"
 
 namespace translator {
 
@@ -19,54 +20,49 @@ namespace translator {
  * Her düğüm bir deyimi, her kenar ise kontrol akışını temsil eder.
  */
 struct CFG {
-    ds::Graph g;                                    ///< Kontrol akışı grafı
-    std::unordered_map<int, int> label_to_index;    ///< Etiket→indeks eşlemesi
+    ds::Graph g;                ///< Kontrol akışı grafı
+    LabelIndex label_to_index;  ///< Etiket→indeks eşlemesi (programın dizininin kopyası)
 };
 
+namespace detail {
+
 /**
- * @brief Programdan basit CFG oluşturur
- * @param p Girdi programı
+ * @brief Deyim türü ve hedef erişimcilerinden CFG kurar
+ * @param labels Satır etiketleri
+ * @param index labels için kurulmuş etiket dizini
+ * @param kind_at i. deyimin türünü döndüren işlev
+ * @param target_at i. atlama deyiminin hedef etiketini döndüren işlev
  * @return Üretilen CFG
- * 
- * Bu fonksiyon, BASIC programındaki GOTO, IF-GOTO, GOSUB ve RETURN
- * deyimlerini analiz ederek kontrol akışı grafını oluşturur.
+ *
+ * Program ve FlatProgram aynı kenar kurallarını paylaşır; yalnızca
+ * deyimlere erişim biçimleri farklıdır.
  */
-inline CFG build_cfg(const Program& p){
+template <typename KindAt, typename TargetAt>
+CFG build_cfg_from(const std::vector<int>& labels, const LabelIndex& index, KindAt kind_at, TargetAt target_at){
     CFG cfg; 
-    int n = static_cast<int>(p.stmts.size()); 
+    int n = static_cast<int>(labels.size()); 
     cfg.g.resize(n);
-    
-    // Etiket→indeks eşlemesini oluştur
-    for (int i=0;i<n;i++){ 
-        cfg.label_to_index[p.labels[i]] = i; 
-    }
+    cfg.label_to_index = index;
     
     // Bir sonraki indeksi hesaplayan lambda
     auto next_index = [&](int i)->int{ return (i+1<n)?(i+1):-1; };
     
     // Her deyim için kontrol akışını analiz et
     for (int i=0;i<n;i++){
-        auto& s = p.stmts[i];
         int ni = next_index(i);
         
-        switch (s->kind()){
+        switch (kind_at(i)){
             case StmtKind::Goto: {
-                int tgt = static_cast<GotoStmt*>(s.get())->target;
-                auto it = cfg.label_to_index.find(tgt);
-                if (it!=cfg.label_to_index.end()) cfg.g.add_edge(i, it->second);
+                int t = index.find(target_at(i));
+                if (t!=LabelIndex::npos) cfg.g.add_edge(i, t);
                 break;
             }
-            case StmtKind::IfGoto: {
-                int tgt = static_cast<IfGotoStmt*>(s.get())->target;
-                auto it = cfg.label_to_index.find(tgt);
-                if (it!=cfg.label_to_index.end()) cfg.g.add_edge(i, it->second);
-                if (ni!=-1) cfg.g.add_edge(i, ni);
-                break;
-            }
-            case StmtKind::Gosub: {
-                int tgt = static_cast<GosubStmt*>(s.get())->target;
-                auto it = cfg.label_to_index.find(tgt);
-                if (it!=cfg.label_to_index.end()) cfg.g.add_edge(i, it->second);
+            case StmtKind::IfGoto:
+            case StmtKind::Gosub:
+            case StmtKind::For:     // sınır aşıldıysa çıkışa
+            case StmtKind::Next: {  // sınır aşılmadıysa gövdeye
+                int t = index.find(target_at(i));
+                if (t!=LabelIndex::npos) cfg.g.add_edge(i, t);
                 if (ni!=-1) cfg.g.add_edge(i, ni);
                 break;
             }
@@ -84,4 +80,40 @@ inline CFG build_cfg(const Program& p){
     return cfg;
 }
 
+} // namespace detail
+
+/**
+ * @brief Programdan basit CFG oluşturur
+ * @param p Girdi programı
+ * @return Üretilen CFG
+ * 
+ * Bu fonksiyon, BASIC programındaki GOTO, IF-GOTO, GOSUB, RETURN, FOR
+ * ve NEXT deyimlerini analiz ederek kontrol akışı grafını oluşturur.
+ */
+inline CFG build_cfg(const Program& p){
+    return detail::build_cfg_from(p.labels, current_index(p.index, p.labels),
+        [&](int i){ return p.stmts[i]->kind(); },
+        [&](int i){
+            const Stmt* s = p.stmts[i];
+            switch (s->kind()){
+                case StmtKind::Goto: return static_cast<const GotoStmt*>(s)->target;
+                case StmtKind::IfGoto: return static_cast<const IfGotoStmt*>(s)->target;
+                case StmtKind::For: return static_cast<const ForStmt*>(s)->exit;
+                case StmtKind::Next: return static_cast<const NextStmt*>(s)->body;
+                default: return static_cast<const GosubStmt*>(s)->target;
+            }
+        });
+}
+
+/**
+ * @brief Düz programdan CFG oluşturur
+ * @param p Girdi programı
+ * @return Program sürümüyle aynı CFG; deyimler dizilerden okunur
+ */
+inline CFG build_cfg(const FlatProgram& p){
+    return detail::build_cfg_from(p.labels, current_index(p.index, p.labels),
+        [&](int i){ return p.stmt_kind[i]; },
+        [&](int i){ return p.stmt_a[i]; });
+}
+
 } // namespace translator
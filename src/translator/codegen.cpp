@@ -3,103 +3,855 @@
  * @brief AST'yi C++ kaynak koduna dönüştüren yordamların uygulaması.
  */
 #include "translator/codegen.h"
-#include <sstream>
+#include "translator/cfg.h"
+#include "translator/structure.h"
+#include "translator/optimize.h"
+#include "translator/emitter.h"
+#include "translator/types.h"
+#include <algorithm>
+#include <charconv>
+#include <utility>
+#include <vector>
 
 namespace translator {
 
+namespace {
+
+/**
+ * \brief Kod üretiminde değişken erişim metinleri ve (türlü kipte) türler.
+ */
+struct VarRefs {
+    const std::vector<std::string>& text;   ///< Kimlik başına erişim metni
+    const TypeInfo* types = nullptr;        ///< Türlü kipte infer_types() sonucu
+    bool loops_in_map = false;              ///< FOR sınır ve adımı yerel yerine `var` haritasında (akış kipi)
+
+    const std::string& operator[](NodeIndex id) const { return text[id]; }
+
+    /** \brief İfade türlü kipte tamsayı mı? */
+    bool is_int(NodeIndex e) const { return types && types->exprs[e] == ValueType::Int; }
+
+    /**
+     * \brief FOR döngüsünün gizli sınır ya da adım değişkeni.
+     * \param loop Döngü kimliği (gövde etiketi)
+     * \param what "to" ya da "step"
+     * \return `to_20` gibi bir yerel; haritada BASIC adı olamayacak `var["to 20"]`
+     */
+    std::string loop(int loop, const char* what) const {
+        const std::string key = std::string(what) + (loops_in_map ? " " : "_") + std::to_string(loop);
+        return loops_in_map ? "var[\"" + key + "\"]" : key;
+    }
+};
+
+} // namespace
+
+/**
+ * \brief BinaryExpr operatörünü C++ yazımıyla ekler.
+ * \param os Çıktı tamponu
+ * \param op BinaryExpr::op karakteri
+ */
+static void emit_operator(Emitter& os, char op){
+    switch (op){
+        case '=': os << "=="; break;
+        case 'N': os << "!="; break;
+        case 'L': os << "<="; break;
+        case 'G': os << ">="; break;
+        default: os << op; break;
+    }
+}
+
+/**
+ * \brief Sayı sabitini C++ `double` sabiti olarak yazar.
+ * \param os Çıktı tamponu
+ * \param v Değer
+ *
+ * En kısa geri okunabilir biçim kullanılır; nokta ya da üs içermeyen
+ * yazıma `.0` eklenir. `7` gibi bir tamsayı sabiti C++'ta tamsayı bölmesi
+ * yapar ve `1234567` yazdırıldığında `double` biçimini kaybeder; BASIC
+ * değerleri her zaman `double`'dır.
+ */
+static void emit_number(Emitter& os, double v){
+    char buf[32];
+    char* end = std::to_chars(buf, buf + sizeof(buf), v).ptr;
+    os << std::string_view(buf, static_cast<std::size_t>(end - buf));
+    if (std::find_if(buf, end, [](char c){ return c == '.' || c == 'e'; }) == end) os << ".0";
+}
+
+/**
+ * \brief Düz ifadeyi C++ koduna yazar.
+ * \param os Çıktı tamponu
+ * \param p  İfadenin ait olduğu düz program
+ * \param refs Kimlik başına önceden hazırlanmış değişken erişim metni
+ * \param e  Yazdırılacak ifadenin indeksi
+ */
+static void emit_expr(Emitter& os, const FlatProgram& p, const VarRefs& refs, NodeIndex e){
+    auto leaf = [&](NodeIndex x){
+        if (p.expr_kind[x] == ExprKind::Variable){ os << refs[p.expr_a[x]]; return; }
+        // Türlü kipte tamsayı sabit tamsayı yazılır; `1e+06` işlemi double'da yaptırırdı.
+        if (refs.is_int(x)) os << std::to_string(static_cast<long long>(p.numbers[p.expr_a[x]]));
+        else emit_number(os, p.numbers[p.expr_a[x]]);
+    };
+    if (p.expr_kind[e] != ExprKind::Binary){ leaf(e); return; }
+    // Açık yığın: (düğüm, aşama). İkili düğüm üç kez görülür: açılış, işleç ve kapanış.
+    std::vector<std::pair<NodeIndex, unsigned char>> todo{{e, 0}};
+    while (!todo.empty()){
+        auto [x, stage] = todo.back(); todo.pop_back();
+        if (p.expr_kind[x] != ExprKind::Binary){ leaf(x); continue; }
+        const NodeIndex a = p.expr_a[x], b = p.expr_b[x];
+        // İki tamsayı işlenen C++'ta tamsayı işlemi yapar; `double` düğüm (`/`, -0 verebilen
+        // ya da 2^53'ü aşabilen `*`) double'da hesaplanmalıdır.
+        const bool widen = refs.types && !refs.is_int(x) && refs.is_int(a) && refs.is_int(b);
+        switch (stage){
+            case 0: os << (widen ? "(double(" : "("); todo.push_back({x, 1}); todo.push_back({a, 0}); break;
+            case 1: os << (widen ? ") " : " "); emit_operator(os, p.expr_op[x]); os << ' '; todo.push_back({x, 2}); todo.push_back({b, 0}); break;
+            default: os << ')'; break;
+        }
+    }
+}
+
+/** \brief Düz ifadenin C++ metni. */
+static std::string expr_text(const FlatProgram& p, const VarRefs& refs, NodeIndex e){
+    Emitter os(32);
+    emit_expr(os, p, refs, e);
+    return os.take();
+}
+
 /**
- * \brief İfadeyi (Expr) C++ koduna yazar.
- * \param os Çıktı akışı
- * \param e  Yazdırılacak ifade düğümü
+ * \brief Döngü koşulunu adımın işaretine göre yazar.
+ * \param os Çıktı tamponu
+ * \param var Döngü değişkeni
+ * \param to Sınır
+ * \param step Adım
+ * \param done true ise FOR'un "sınır aşıldı" koşulu, değilse NEXT'in "sürüyor" koşulu.
+ *        Biri diğerinin tam değilidir; sınır NaN olduğunda da doğal `for` ile aynı sonucu verir.
  */
-static void emit_expr(std::ostream& os, const Expr* e){
-    switch (e->kind()){
-        case ExprKind::Number: os << static_cast<const NumberExpr*>(e)->value; break;
-        case ExprKind::Variable: os << "var[\"" << static_cast<const VariableExpr*>(e)->name << "\"]"; break;
-        case ExprKind::Binary: {
-            auto* b = static_cast<const BinaryExpr*>(e);
-            os << '('; emit_expr(os, b->lhs.get()); os << ' ' << b->op << ' '; emit_expr(os, b->rhs.get()); os << ')';
+static void emit_loop_test(Emitter& os, const std::string& var, const std::string& to, const std::string& step, bool done){
+    os << (done ? "(!(" : "(") << step << " >= 0 ? " << var << " <= " << to << " : " << var << " >= " << to << (done ? "))" : ")");
+}
+
+/**
+ * \brief FOR'un girişini yazar: sınır ve adım gizli değişkenlere, ardından başlangıç döngü değişkenine.
+ * \param os Çıktı tamponu
+ * \param p Düz program
+ * \param refs Değişken erişim metinleri
+ * \param i FOR deyiminin indeksi
+ * \param loop Döngü kimliği (FOR'dan sonraki deyimin etiketi)
+ */
+static void emit_for_init(Emitter& os, const FlatProgram& p, const VarRefs& refs, std::size_t i, int loop){
+    const NodeIndex* it = &p.items[p.stmt_b[i]];
+    os << refs.loop(loop, "to") << " = "; emit_expr(os, p, refs, it[2]);
+    os << "; " << refs.loop(loop, "step") << " = "; emit_expr(os, p, refs, it[3]);
+    os << "; " << refs[p.expr_a[it[0]]] << " = "; emit_expr(os, p, refs, it[1]); os << ";";
+}
+
+/**
+ * \brief Değişken türlü kipte tamsayı mı?
+ * \param types infer_types() sonucu; türsüz kipte nullptr
+ * \param id Değişken kimliği
+ */
+static bool int_var(const TypeInfo* types, std::size_t id){ return types && types->vars[id] == ValueType::Int; }
+
+/**
+ * \brief Her değişken kimliği için üretilecek erişim metnini hazırlar.
+ * \param names Kimlik sırasıyla değişken adları
+ * \param vars Saklama biçimi
+ * \param types Türlü kipte infer_types() sonucu; tamsayı değişkenler ayrı
+ *              bir haritada (`ivar`) ya da dizide (`islots`) tutulur
+ * \return Kimlik başına erişim metni (ör. `var["X"]`, `slots[0]`, `v_X`)
+ */
+static std::vector<std::string> var_refs(const std::vector<std::string>& names, VarStorage vars, const TypeInfo* types = nullptr){
+    std::vector<std::string> refs; refs.reserve(names.size());
+    std::size_t ints = 0, reals = 0;
+    for (std::size_t i=0;i<names.size();++i){
+        const bool is_int = int_var(types, i);
+        switch (vars){
+            case VarStorage::Map: refs.push_back((is_int ? "ivar[\"" : "var[\"") + names[i] + "\"]"); break;
+            case VarStorage::Slots: refs.push_back(is_int ? "islots[" + std::to_string(ints++) + "]" : "slots[" + std::to_string(reals++) + "]"); break;
+            case VarStorage::Locals: refs.push_back("v_" + names[i]); break;
+        }
+    }
+    return refs;
+}
+
+/**
+ * \brief Değişken deposunun bildirimini yazar.
+ * \param os Çıktı tamponu
+ * \param names Kimlik sırasıyla değişken adları
+ * \param vars Saklama biçimi
+ * \param types Türlü kipte infer_types() sonucu (bkz. var_refs)
+ *
+ * Yuvalar ve yereller sıfırla başlatılır; bu, haritada henüz atanmamış
+ * bir değişkenin okunmasıyla aynı değeri verir.
+ */
+static void emit_var_decls(Emitter& os, const std::vector<std::string>& names, VarStorage vars, const TypeInfo* types = nullptr){
+    const std::size_t ints = types ? types->int_vars() : 0;
+    switch (vars){
+        case VarStorage::Map: {
+            os << "  std::unordered_map<std::string,double> var;\n";
+            if (ints) os << "  std::unordered_map<std::string,std::int64_t> ivar;\n";
+            break;
+        }
+        case VarStorage::Slots: {
+            // Yuva dizisi başına: C++ türü, boyu ve yorum satırındaki ad listesi.
+            for (const bool want_int : {false, true}){
+                const std::size_t n = want_int ? ints : names.size() - ints;
+                if (n == 0) continue;
+                os << (want_int ? "  std::int64_t islots[" : "  double slots[") << n << "] = {};";
+                std::size_t k = 0;
+                for (std::size_t i=0;i<names.size();++i){
+                    if (int_var(types, i) != want_int) continue;
+                    os << (k ? ", " : "  // ") << k << ": " << names[i]; ++k;
+                }
+                os << "\n";
+            }
+            break;
+        }
+        case VarStorage::Locals: {
+            for (std::size_t i=0;i<names.size();++i) os << (int_var(types, i) ? "  std::int64_t v_" : "  double v_") << names[i] << " = 0;\n";
             break;
         }
     }
 }
 
 /**
- * \brief Verilen Program AST'sinden C++ kodu üretir.
- * \param p Etiketlenmiş deyimlerden oluşan Program
- * \return Derlenebilir C++ kaynak kodu
+ * \brief FOR döngülerinin gizli sınır ve adım değişkenlerini bildirir.
+ * \param os Çıktı tamponu
+ * \param p Düz program
+ * \param refs Değişken erişim metinleri; türlü kipte tamsayı ifadeler `std::int64_t` alır
+ * \param st Yapısal kipte çözümleme; doğal `for` olan döngülerde sabit
+ *           sınır ya da adım doğrudan yazıldığından değişkeni bildirilmez
  */
-std::string Codegen::emit_cpp(const Program& p){
-    std::ostringstream ss;
-    ss << "#include <iostream>\n";
-    ss << "#include <string>\n";
-    ss << "#include <unordered_map>\n";
-    ss << "#include <stack>\n\n";
-    ss << "int main(){\n";
-    ss << "  std::unordered_map<std::string,double> var;\n";
-    ss << "  std::stack<int> call;\n";
-    if (p.stmts.empty()) { ss << "  return 0;\n}"; return ss.str(); }
-    int start = p.labels.front();
-    ss << "  int pc = " << start << ";\n";
+static void emit_loop_decls(Emitter& os, const FlatProgram& p, const VarRefs& refs, const Structure* st){
+    const std::size_t n = p.size();
+    std::vector<unsigned char> native(n, 0);
+    if (st) for (const Region& r : st->regions) if (r.kind == RegionKind::For) native[r.begin] = 1;
+    auto decl = [&](NodeIndex e, int loop, const char* what){
+        os << (refs.is_int(e) ? "  std::int64_t " : "  double ") << refs.loop(loop, what) << " = 0;\n";
+    };
+    for (std::size_t i=0;i<n;++i){
+        if (p.stmt_kind[i] == StmtKind::For){
+            const NodeIndex* it = &p.items[p.stmt_b[i]];
+            const int loop = i + 1 < n ? p.labels[i + 1] : -1;
+            if (!native[i] || p.expr_kind[it[2]] != ExprKind::Number) decl(it[2], loop, "to");
+            if (!native[i] || p.expr_kind[it[3]] != ExprKind::Number) decl(it[3], loop, "step");
+        } else if (p.stmt_kind[i] == StmtKind::Next){
+            // FOR'u erişilemez diye silinmiş bir NEXT de bu değişkenleri okur.
+            const int f = p.index.find(p.stmt_a[i]) - 1;
+            if (f >= 0 && p.stmt_kind[f] == StmtKind::For) continue;
+            os << "  double " << refs.loop(p.stmt_a[i], "to") << " = 0;\n";
+            os << "  double " << refs.loop(p.stmt_a[i], "step") << " = 0;\n";
+        }
+    }
+}
+
+/**
+ * \brief Yan etkili basit deyimi (LET, PRINT, INPUT) girintisiz ve satır sonu olmadan yazar.
+ * \param os Çıktı tamponu
+ * \param p Düz program
+ * \param refs Değişken erişim metinleri
+ * \param i Deyim indeksi
+ */
+static void emit_action(Emitter& os, const FlatProgram& p, const VarRefs& refs, std::size_t i){
+    const NodeIndex a = p.stmt_a[i], b = p.stmt_b[i];
+    switch (p.stmt_kind[i]){
+        case StmtKind::Let: os << refs[a] << " = "; emit_expr(os, p, refs, b); os << ";"; break;
+        case StmtKind::Print: {
+            os << "std::cout";
+            // Tamsayı değer double gibi biçimlenir: `1234567` değil `1.23457e+06`.
+            for (NodeIndex k=0;k<b;++k){
+                const NodeIndex e = p.items[a+k];
+                os << (refs.is_int(e) ? " << static_cast<double>(" : " << ");
+                emit_expr(os, p, refs, e);
+                if (refs.is_int(e)) os << ")";
+            }
+            os << " << std::endl;";
+            break;
+        }
+        case StmtKind::Input: os << "{ double tmp; std::cin >> tmp; " << refs[a] << " = tmp; }"; break;
+        default: break;
+    }
+}
+
+/**
+ * \brief Dispatch kipinde atlama hedefinin adını yazar.
+ * \param os Çıktı tamponu
+ * \param label Hedef etiket; negatifse programı bitiren `END`
+ * \param named false ise etiketin kendisi yazılır (akış kipi; negatif
+ *              değerler yalnızca StreamCodegen'in FOR çıkışlarıdır)
+ *
+ * Adlar, programın başındaki `enum` ile deyim numaralarına bağlanır;
+ * böylece `switch` yoğun 0..n aralığında çalışır ve derleyici atlama
+ * tablosu üretir, bloklar ise yalnızca etiketlere bağlı kalır.
+ */
+static void emit_target(Emitter& os, int label, bool named = true){
+    if (!named) os << label;
+    else if (label < 0) os << "END";
+    else os << 'L' << label;
+}
+
+/**
+ * \brief Tek bir deyimi dispatch döngüsünün `case` bloğu olarak yazar.
+ * \param ss Çıktı tamponu
+ * \param p Düz program
+ * \param refs Değişken erişim metinleri
+ * \param i Deyim indeksi
+ * \param next_label Sonraki deyimin etiketi; son deyimde -1
+ * \param named Hedefler `enum` adlarıyla mı yazılsın (bkz. emit_target)
+ *
+ * Blok yalnızca deyimin kendisine ve next_label'a bağlıdır; artımlı
+ * çeviri bu nedenle blokları ayrı ayrı saklayabilir.
+ */
+static void emit_case(Emitter& ss, const FlatProgram& p, const VarRefs& refs, std::size_t i, int next_label, bool named = true){
+    ss << "    case "; emit_target(ss, p.labels[i], named); ss << ": {\n";
+    const NodeIndex a = p.stmt_a[i], b = p.stmt_b[i];
+    switch (p.stmt_kind[i]){
+        case StmtKind::Let:
+        case StmtKind::Print:
+        case StmtKind::Input: {
+            ss << "      "; emit_action(ss, p, refs, i); ss << "\n";
+            if (next_label!=-1){ ss << "      pc = "; emit_target(ss, next_label, named); ss << "; break;\n"; } else ss << "      return 0;\n";
+            break;
+        }
+        case StmtKind::Goto: {
+            ss << "      pc = "; emit_target(ss, a, named); ss << "; break;\n";
+            break;
+        }
+        case StmtKind::IfGoto: {
+            ss << "      if ("; emit_expr(ss, p, refs, b); ss << ") pc = "; emit_target(ss, a, named); ss << "; else ";
+            if (next_label!=-1){ ss << "pc = "; emit_target(ss, next_label, named); ss << ";\n"; } else ss << "return 0;\n";
+            ss << "      break;\n";
+            break;
+        }
+        case StmtKind::Gosub: {
+            if (next_label!=-1){ ss << "      call.push("; emit_target(ss, next_label, named); ss << "); pc = "; emit_target(ss, a, named); ss << "; break;\n"; }
+            else ss << "      return 0;\n";
+            break;
+        }
+        case StmtKind::Return: {
+            ss << "      if (call.empty()) return 0; pc = call.top(); call.pop(); break;\n";
+            break;
+        }
+        case StmtKind::For: {
+            // Döngünün kimliği FOR'dan sonraki deyimin etiketidir; FOR'u her zaman en az NEXT izler.
+            const std::string& var = refs[p.expr_a[p.items[b]]];
+            ss << "      "; emit_for_init(ss, p, refs, i, next_label); ss << "\n";
+            ss << "      if "; emit_loop_test(ss, var, refs.loop(next_label, "to"), refs.loop(next_label, "step"), true);
+            ss << " pc = "; emit_target(ss, a, named); ss << "; else ";
+            if (next_label!=-1){ ss << "pc = "; emit_target(ss, next_label, named); ss << ";\n"; } else ss << "return 0;\n";
+            ss << "      break;\n";
+            break;
+        }
+        case StmtKind::Next: {
+            const std::string& var = refs[b];
+            ss << "      " << var << " += " << refs.loop(a, "step") << ";\n";
+            ss << "      if "; emit_loop_test(ss, var, refs.loop(a, "to"), refs.loop(a, "step"), false);
+            ss << " pc = "; emit_target(ss, a, named); ss << "; else ";
+            if (next_label!=-1){ ss << "pc = "; emit_target(ss, next_label, named); ss << ";\n"; } else ss << "return 0;\n";
+            ss << "      break;\n";
+            break;
+        }
+    }
+    ss << "    }\n";
+}
+
+/**
+ * \brief Dispatch döngüsünün açılışını yazar.
+ * \param ss Çıktı tamponu
+ * \param labels Deyim sırasıyla etiketler (boş olmamalı)
+ * \param index labels'ın dizini
+ * \param targets Atlama hedefleri; programda olmayanlar `END`e bağlanır
+ *
+ * Etiket adları deyim numaralarını alır (`L10` = 0, `L20` = 1, ...),
+ * `END` = n ise `default` ile programı bitirir.
+ */
+static void emit_dispatch_head(Emitter& ss, const std::vector<int>& labels, const LabelIndex& index, std::vector<int> targets){
+    ss << "  enum : int { ";
+    for (int l : labels){ emit_target(ss, l); ss << ", "; }
+    ss << "END";
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+    for (int t : targets) if (t >= 0 && !index.contains(t)){ ss << ", "; emit_target(ss, t); ss << " = END"; }
+    ss << " };\n";
+    ss << "  int pc = "; emit_target(ss, labels.front()); ss << ";\n";
     ss << "  while(true){\n";
     ss << "    switch(pc){\n";
-    for (std::size_t i=0;i<p.stmts.size();++i){
-        int lbl = p.labels[i];
-        ss << "    case " << lbl << ": {\n";
-        const auto& st = p.stmts[i];
-        auto next_label = (i+1<p.stmts.size()) ? p.labels[i+1] : -1;
-        switch (st->kind()){
-            case StmtKind::Let: {
-                auto* s = static_cast<LetStmt*>(st.get());
-                ss << "      var[\"" << s->name << "\"] = "; emit_expr(ss, s->expr.get()); ss << ";\n";
-                if (next_label!=-1) ss << "      pc = " << next_label << "; break;\n"; else ss << "      return 0;\n";
-                break;
+}
+
+/** \brief Dispatch döngüsünün kapanışını yazar. */
+static void emit_dispatch_tail(Emitter& ss){
+    ss << "    default: return 0;\n";
+    ss << "    }\n";
+    ss << "  }\n";
+}
+
+/**
+ * \brief Deyimin atlama hedefi.
+ * \return GOTO / IF / GOSUB hedef etiketi, FOR çıkışı ya da NEXT gövdesi; diğer deyimlerde -1
+ */
+static int jump_target(const FlatProgram& p, std::size_t i){
+    switch (p.stmt_kind[i]){
+        case StmtKind::Goto: case StmtKind::IfGoto: case StmtKind::Gosub:
+        case StmtKind::For: case StmtKind::Next: return p.stmt_a[i];
+        default: return -1;
+    }
+}
+
+/**
+ * \brief Her deyimi `while(true){switch(pc)}` içinde bir `case` olarak yazar.
+ * \param ss Çıktı tamponu
+ * \param p Boş olmayan düz program
+ * \param refs Değişken erişim metinleri
+ */
+static void emit_dispatch(Emitter& ss, const FlatProgram& p, const VarRefs& refs){
+    std::vector<int> targets;
+    for (std::size_t i=0;i<p.size();++i) targets.push_back(jump_target(p, i));
+    emit_dispatch_head(ss, p.labels, p.index, std::move(targets));
+    for (std::size_t i=0;i<p.size();++i) emit_case(ss, p, refs, i, (i+1<p.size()) ? p.labels[i+1] : -1);
+    emit_dispatch_tail(ss);
+}
+
+namespace {
+
+/**
+ * \brief recover_structure() bölgelerinden yapısal C++ (while / for / if / else) üretir.
+ *
+ * Bölgesiz bir çözümleme (find_basic_blocks()) verildiğinde çıktı,
+ * blok içinde düz akan ve bloklar arasında `goto` kullanan koddur.
+ *
+ * FOR/NEXT bölgeleri doğal `for` döngüsü olur: sınır ve adım girişte bir
+ * kez hesaplanır, sabitse doğrudan yazılır; böylece C++ derleyicisi
+ * döngüyü açabilir ya da vektörleştirebilir. Bölgeye sığmayan FOR ve NEXT
+ * gizli değişkenler ve atlamalarla yazılır.
+ *
+ * Bölgeye dönüşmeyen atlamalar en içteki döngüye göre `continue`,
+ * `break` ya da `goto L<etiket>` olur; `for` içinde NEXT'e atlamak
+ * `continue`'dur. GOSUB dönüş adresini yığına
+ * koyup hedefe atlar; RETURN tek bir ortak `switch` üzerinden ilgili
+ * `ret_<n>` etiketine döner.
+ */
+class StructuredEmitter {
+    /// Atlamanın yapısal karşılığı.
+    enum class Jump { Fallthrough, Continue, Break, Goto, Exit };
+
+    Emitter& os_;
+    const FlatProgram& p_;
+    const VarRefs& refs_;
+    const Structure& st_;
+    std::vector<unsigned char> consumed_;   ///< Bölge tarafından ifade edilen deyimler
+    std::vector<unsigned char> label_;      ///< goto hedefi olan deyimler
+    std::vector<unsigned char> placed_;     ///< Etiketi yazılmış deyimler
+    std::vector<int> ret_site_;             ///< GOSUB deyimi başına dönüş noktası numarası
+    int returns_ = 0;                       ///< Dönüş noktası sayısı
+    std::size_t next_region_ = 0;           ///< Ön-sırada sıradaki bölge
+
+    /**
+     * \brief s deyiminden d deyimine atlamayı sınıflandırır.
+     * \param s Atlayan deyim
+     * \param d Hedef deyim (-1: bilinmeyen etiket)
+     */
+    Jump resolve(int s, int d) const {
+        if (d < 0) return Jump::Exit;
+        if (d == s + 1) return Jump::Fallthrough;
+        int l = st_.loop_of[s];
+        if (l < 0) return Jump::Goto;
+        const Region& r = st_.regions[l];
+        if (d == (r.kind == RegionKind::For ? r.end : r.begin)) return Jump::Continue;
+        if (d == r.end + 1) return Jump::Break;
+        return Jump::Goto;
+    }
+
+    void indent(int depth){ for (int i=0;i<depth;++i) os_ << "  "; }
+
+    /** \brief Atlamayı tek bir C++ deyimi olarak yazar (Fallthrough için hiçbir şey). */
+    void emit_jump(Jump j, int d){
+        switch (j){
+            case Jump::Fallthrough: break;
+            case Jump::Continue: os_ << "continue;"; break;
+            case Jump::Break: os_ << "break;"; break;
+            case Jump::Goto: os_ << "goto L" << p_.labels[d] << ";"; break;
+            case Jump::Exit: os_ << "return 0;"; break;
+        }
+    }
+
+    /** \brief Deyim bir goto hedefiyse etiketini (bir kez) yazar. */
+    void place_label(int s, int depth){
+        if (!label_[s] || placed_[s]) return;
+        placed_[s] = 1;
+        indent(depth - 1); os_ << " L" << p_.labels[s] << ":;\n";
+    }
+
+    /** \brief Koşul ifadesini yazar. */
+    void cond(int s){ emit_expr(os_, p_, refs_, p_.stmt_b[s]); }
+
+    /** \brief NEXT'in artırımını yazar. */
+    void next_step(int s, int depth){
+        indent(depth); os_ << refs_[p_.stmt_b[s]] << " += " << refs_.loop(p_.stmt_a[s], "step") << ";\n";
+    }
+
+    /** \brief NEXT'ten sonra döngünün sürdüğü koşulunu yazar. */
+    void next_test(int s){
+        const int loop = p_.stmt_a[s];
+        emit_loop_test(os_, refs_[p_.stmt_b[s]], refs_.loop(loop, "to"), refs_.loop(loop, "step"), false);
+    }
+
+    /** \brief FOR/NEXT bölgesini doğal `for` döngüsü olarak yazar. */
+    void emit_for(const Region& r, int depth){
+        const NodeIndex* it = &p_.items[p_.stmt_b[r.begin]];
+        const std::string& var = refs_[p_.expr_a[it[0]]];
+        const int loop = p_.labels[r.begin + 1];
+        const bool lit_to = p_.expr_kind[it[2]] == ExprKind::Number, lit_step = p_.expr_kind[it[3]] == ExprKind::Number;
+        // Sabit olmayan sınır ve adım döngüden önce bir kez hesaplanır.
+        const std::string to = lit_to ? expr_text(p_, refs_, it[2]) : refs_.loop(loop, "to");
+        const std::string step = lit_step ? expr_text(p_, refs_, it[3]) : refs_.loop(loop, "step");
+        if (!lit_to){ indent(depth); os_ << to << " = "; emit_expr(os_, p_, refs_, it[2]); os_ << ";\n"; }
+        if (!lit_step){ indent(depth); os_ << step << " = "; emit_expr(os_, p_, refs_, it[3]); os_ << ";\n"; }
+        indent(depth); os_ << "for (" << var << " = "; emit_expr(os_, p_, refs_, it[1]); os_ << "; ";
+        if (lit_step) os_ << var << (p_.numbers[p_.expr_a[it[3]]] >= 0 ? " <= " : " >= ") << to;
+        else emit_loop_test(os_, var, to, step, false);
+        os_ << "; " << var << " += " << step << ") {\n";
+        emit_range(r.begin + 1, r.end - 1, depth + 1);
+        // NEXT'e atlayan goto gövdenin sonuna iner; oradan artırıma geçilir.
+        place_label(r.end, depth + 1);
+        indent(depth); os_ << "}\n";
+    }
+
+    void emit_range(int lo, int hi, int depth){
+        int s = lo;
+        while (s <= hi){
+            if (next_region_ < st_.regions.size() && st_.regions[next_region_].begin == s){
+                const Region& r = st_.regions[next_region_++];
+                emit_region(r, depth);
+                s = r.end + 1;
+            } else {
+                emit_stmt(s++, depth);
             }
-            case StmtKind::Print: {
-                auto* s = static_cast<PrintStmt*>(st.get());
-                ss << "      std::cout";
-                for (std::size_t k=0;k<s->items.size();++k){
-                    ss << " << "; emit_expr(ss, s->items[k].get());
+        }
+    }
+
+    void emit_region(const Region& r, int depth){
+        place_label(r.begin, depth);
+        switch (r.kind){
+            case RegionKind::Loop: {
+                indent(depth); os_ << "while (true) {\n";
+                emit_range(r.begin, r.end - 1, depth + 1);
+                place_label(r.end, depth + 1);
+                if (p_.stmt_kind[r.end] == StmtKind::IfGoto){ indent(depth + 1); os_ << "if (!("; cond(r.end); os_ << ")) break;\n"; }
+                if (p_.stmt_kind[r.end] == StmtKind::Next){
+                    next_step(r.end, depth + 1);
+                    indent(depth + 1); os_ << "if (!"; next_test(r.end); os_ << ") break;\n";
                 }
-                ss << " << std::endl;\n";
-                if (next_label!=-1) ss << "      pc = " << next_label << "; break;\n"; else ss << "      return 0;\n";
+                indent(depth); os_ << "}\n";
                 break;
             }
-            case StmtKind::Input: {
-                auto* s = static_cast<InputStmt*>(st.get());
-                ss << "      { double tmp; std::cin >> tmp; var[\"" << s->name << "\"] = tmp; }\n";
-                if (next_label!=-1) ss << "      pc = " << next_label << "; break;\n"; else ss << "      return 0;\n";
+            case RegionKind::For: emit_for(r, depth); break;
+            case RegionKind::If: {
+                indent(depth); os_ << "if (!("; cond(r.begin); os_ << ")) {\n";
+                emit_range(r.begin + 1, r.end, depth + 1);
+                indent(depth); os_ << "}\n";
                 break;
             }
+            case RegionKind::IfElse: {
+                if (r.split - 2 < r.begin + 1){
+                    indent(depth); os_ << "if ("; cond(r.begin); os_ << ") {\n";
+                } else {
+                    indent(depth); os_ << "if (!("; cond(r.begin); os_ << ")) {\n";
+                    emit_range(r.begin + 1, r.split - 2, depth + 1);
+                    indent(depth); os_ << "} else {\n";
+                }
+                emit_range(r.split, r.end, depth + 1);
+                indent(depth); os_ << "}\n";
+                break;
+            }
+        }
+    }
+
+    void emit_stmt(int s, int depth){
+        place_label(s, depth);
+        const int d = st_.target[s];
+        switch (p_.stmt_kind[s]){
+            case StmtKind::Let:
+            case StmtKind::Print:
+            case StmtKind::Input: indent(depth); emit_action(os_, p_, refs_, s); os_ << "\n"; break;
             case StmtKind::Goto: {
-                auto* s = static_cast<GotoStmt*>(st.get());
-                ss << "      pc = " << s->target << "; break;\n";
+                Jump j = resolve(s, d);
+                if (j != Jump::Fallthrough){ indent(depth); emit_jump(j, d); os_ << "\n"; }
                 break;
             }
             case StmtKind::IfGoto: {
-                auto* s = static_cast<IfGotoStmt*>(st.get());
-                ss << "      if ("; emit_expr(ss, s->cond.get()); ss << ") pc = " << s->target << "; else ";
-                if (next_label!=-1) ss << "pc = " << next_label << ";\n"; else ss << "return 0;\n";
-                ss << "      break;\n";
+                Jump j = resolve(s, d);
+                if (j == Jump::Fallthrough) break;
+                indent(depth); os_ << "if ("; cond(s); os_ << ") "; emit_jump(j, d); os_ << "\n";
                 break;
             }
             case StmtKind::Gosub: {
-                auto* s = static_cast<GosubStmt*>(st.get());
-                if (next_label!=-1) ss << "      call.push(" << next_label << "); pc = " << s->target << "; break;\n"; else ss << "      return 0;\n";
+                indent(depth);
+                if (ret_site_[s] < 0){ os_ << "return 0;\n"; break; }
+                os_ << "call.push(" << ret_site_[s] << "); goto L" << p_.labels[d] << ";\n";
+                indent(depth - 1); os_ << " ret_" << ret_site_[s] << ":;\n";
                 break;
             }
             case StmtKind::Return: {
-                ss << "      if (call.empty()) return 0; pc = call.top(); call.pop(); break;\n";
+                indent(depth); os_ << (returns_ ? "goto do_return;\n" : "return 0;\n");
+                break;
+            }
+            case StmtKind::For: {
+                const int loop = s + 1 < static_cast<int>(p_.size()) ? p_.labels[s + 1] : -1;
+                indent(depth); emit_for_init(os_, p_, refs_, s, loop); os_ << "\n";
+                Jump j = resolve(s, d);
+                if (j == Jump::Fallthrough) break;
+                indent(depth); os_ << "if ";
+                emit_loop_test(os_, refs_[p_.expr_a[p_.items[p_.stmt_b[s]]]], refs_.loop(loop, "to"), refs_.loop(loop, "step"), true);
+                os_ << " "; emit_jump(j, d); os_ << "\n";
+                break;
+            }
+            case StmtKind::Next: {
+                next_step(s, depth);
+                Jump j = resolve(s, d);
+                if (j == Jump::Fallthrough) break;
+                indent(depth); os_ << "if "; next_test(s); os_ << " "; emit_jump(j, d); os_ << "\n";
                 break;
             }
         }
-        ss << "    }\n";
     }
-    ss << "    default: return 0;\n";
-    ss << "    }\n";
-    ss << "  }\n";
+
+public:
+    StructuredEmitter(Emitter& os, const FlatProgram& p, const VarRefs& refs, const Structure& st)
+        : os_(os), p_(p), refs_(refs), st_(st) {
+        const int n = static_cast<int>(p.size());
+        consumed_.assign(n, 0); label_.assign(n, 0); placed_.assign(n, 0); ret_site_.assign(n, -1);
+        for (const Region& r : st.regions){
+            if (r.kind != RegionKind::Loop) consumed_[r.begin] = 1;
+            if (r.kind == RegionKind::Loop || r.kind == RegionKind::For) consumed_[r.end] = 1;
+            if (r.kind == RegionKind::IfElse) consumed_[r.split - 1] = 1;
+        }
+        // Hangi deyimlerin etikete ihtiyaç duyduğu, yazmadan önce bilinmelidir.
+        for (int s=0;s<n;++s){
+            const int d = st.target[s];
+            switch (p.stmt_kind[s]){
+                case StmtKind::Goto:
+                case StmtKind::IfGoto:
+                case StmtKind::For:
+                case StmtKind::Next:
+                    if (!consumed_[s] && resolve(s, d) == Jump::Goto) label_[d] = 1;
+                    break;
+                case StmtKind::Gosub:
+                    if (d >= 0 && s + 1 < n){ label_[d] = 1; ret_site_[s] = returns_++; }
+                    break;
+                default: break;
+            }
+        }
+    }
+
+    /// GOSUB dönüş yığınına ihtiyaç var mı?
+    bool uses_call_stack() const { return returns_ > 0; }
+
+    /** \brief main() gövdesini yazar. */
+    void emit(){
+        emit_range(0, static_cast<int>(p_.size()) - 1, 1);
+        os_ << "  return 0;\n";
+        if (returns_ == 0) return;
+        os_ << " do_return:\n";
+        os_ << "  if (call.empty()) return 0;\n";
+        os_ << "  {\n";
+        os_ << "    int r = call.top(); call.pop();\n";
+        os_ << "    switch (r) {\n";
+        for (int k=0;k<returns_;++k) os_ << "      case " << k << ": goto ret_" << k << ";\n";
+        os_ << "      default: return 0;\n";
+        os_ << "    }\n";
+        os_ << "  }\n";
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verilen Program AST'sinden C++ kodu üretir.
+ * \param p Etiketlenmiş deyimlerden oluşan Program
+ * \param opts Üretim seçenekleri
+ * \return Derlenebilir C++ kaynak kodu
+ */
+std::string Codegen::emit_cpp(const Program& p, const CodegenOptions& opts){
+    Emitter out;
+    emit_cpp(p, opts, out);
+    return out.take();
+}
+
+/**
+ * \brief Verilen Program AST'sinden C++ kodunu tampona yazar.
+ * \param p Etiketlenmiş deyimlerden oluşan Program
+ * \param opts Üretim seçenekleri
+ * \param out Çıktı tamponu
+ */
+void Codegen::emit_cpp(const Program& p, const CodegenOptions& opts, Emitter& out){
+    FlatProgram flat = flatten(p);
+    if (opts.optimize) { translator::optimize(flat); eliminate_dead_code(flat); }
+    emit_cpp(flat, opts, out);
+}
+
+/**
+ * \brief Düz programdan C++ kodu üretir.
+ * \param p Düz program
+ * \param opts Üretim seçenekleri
+ * \return Derlenebilir C++ kaynak kodu
+ */
+std::string Codegen::emit_cpp(const FlatProgram& p, const CodegenOptions& opts){
+    Emitter out;
+    emit_cpp(p, opts, out);
+    return out.take();
+}
+
+/**
+ * \brief Düz programdan C++ kodunu tampona yazar.
+ * \param p Düz program
+ * \param opts Üretim seçenekleri
+ * \param ss Çıktı tamponu
+ */
+void Codegen::emit_cpp(const FlatProgram& p, const CodegenOptions& opts, Emitter& ss){
+    if (!p.index.matches(p.labels)){
+        // Elle kurulmuş ya da düzenlenmiş programın dizini bayat; kopyada yeniden kurulur.
+        FlatProgram fixed = p;
+        fixed.index = LabelIndex(fixed.labels);
+        emit_cpp(fixed, opts, ss);
+        return;
+    }
+    const bool map = opts.vars == VarStorage::Map;
+    // Değişken erişimleri kimlik başına bir kez biçimlenir.
+    TypeInfo types;
+    if (opts.typed) types = infer_types(p);
+    const TypeInfo* typed = opts.typed ? &types : nullptr;
+    const std::vector<std::string> names = var_refs(p.names, opts.vars, typed);
+    const VarRefs refs{names, typed};
+    // Deyim başına kabaca bir satırlık yer; büyüme kopyalarını azaltır.
+    ss.reserve(256 + p.size() * 64);
+    auto prologue = [&](bool calls, const Structure* st){
+        ss << "#include <iostream>\n";
+        if (typed && types.int_vars()) ss << "#include <cstdint>\n";
+        if (map) ss << "#include <string>\n" << "#include <unordered_map>\n";
+        if (calls) ss << "#include <stack>\n";
+        ss << "\n";
+        ss << "int main(){\n";
+        emit_var_decls(ss, p.names, opts.vars, typed);
+        emit_loop_decls(ss, p, refs, st);
+        if (calls) ss << "  std::stack<int> call;\n";
+    };
+    if (opts.flow != ControlFlow::Dispatch && !p.empty()){
+        const CFG cfg = build_cfg(p);
+        const Structure st = opts.flow == ControlFlow::Structured ? recover_structure(p, cfg) : find_basic_blocks(p, cfg);
+        StructuredEmitter se(ss, p, refs, st);
+        prologue(se.uses_call_stack(), &st);
+        se.emit();
+    } else {
+        prologue(true, nullptr);
+        if (p.empty()) { ss << "  return 0;\n}"; return; }
+        emit_dispatch(ss, p, refs);
+    }
+    ss << "}\n";
+}
+
+/**
+ * \brief Varsayılan kipin (Dispatch, Map) `main` öncesi ve bildirim kısmını yazar.
+ * \param ss Çıktı tamponu
+ */
+static void emit_default_prologue(Emitter& ss){
+    ss << "#include <iostream>\n" << "#include <string>\n" << "#include <unordered_map>\n" << "#include <stack>\n\n";
+    ss << "int main(){\n";
+    emit_var_decls(ss, {}, VarStorage::Map);
+    ss << "  std::stack<int> call;\n";
+}
+
+/**
+ * \brief Dispatch kipinde tek bir deyimin `case` bloğunu üretir.
+ * \param p Düz program
+ * \param i Deyim indeksi
+ * \param next_label Sonraki deyimin etiketi; son deyimde -1
+ * \return Blok metni
+ */
+std::string Codegen::emit_dispatch_case(const FlatProgram& p, std::size_t i, int next_label){
+    Emitter ss(256);
+    const std::vector<std::string> names = var_refs(p.names, VarStorage::Map);
+    emit_case(ss, p, VarRefs{names}, i, next_label);
+    return ss.take();
+}
+
+/**
+ * \brief Dispatch kipinde deyimin atlama hedefini döndürür.
+ * \param p Düz program
+ * \param i Deyim indeksi
+ * \return Hedef etiket; atlama deyimi değilse -1
+ */
+int Codegen::dispatch_target(const FlatProgram& p, std::size_t i){
+    return jump_target(p, i);
+}
+
+/**
+ * \brief emit_dispatch_case() bloklarından tam programı kurar.
+ * \param labels Deyim sırasıyla etiketler
+ * \param targets Blokların atlama hedefleri
+ * \param cases Sırayla `case` blokları
+ * \return emit_cpp() ile aynı çıktı
+ */
+std::string Codegen::assemble_dispatch(const std::vector<int>& labels, const std::vector<int>& targets, const std::vector<std::string_view>& cases){
+    std::size_t bytes = 256 + labels.size() * 24;
+    for (std::string_view c : cases) bytes += c.size();
+    Emitter ss(bytes);
+    emit_default_prologue(ss);
+    if (cases.empty()) { ss << "  return 0;\n}"; return ss.take(); }
+    emit_dispatch_head(ss, labels, LabelIndex(labels), targets);
+    for (std::string_view c : cases) ss << c;
+    emit_dispatch_tail(ss);
     ss << "}\n";
-    return ss.str();
+    return ss.take();
+}
+
+/**
+ * \brief Akış kipinde FOR çıkışının sentetik `case` etiketi.
+ * \param body Döngü kimliği (gövde etiketi, negatif olmayan)
+ * \return `-1 - body`; her gövde etiketi (2147483647 dahil) taşmadan ayrı
+ *         bir negatif değere düşer ve BASIC etiketleriyle çakışmaz. Akış
+ *         kipinde başka hiçbir hedef negatif yazılmaz.
+ */
+static int for_exit_case(int body){ return ~body; }
+
+/**
+ * \brief Bir deyimi alır; bekleyen deyimi artık bilinen sonraki etiketle yazar.
+ * \param label Deyimin etiketi
+ * \param st Deyim; çağrıdan sonra geçerli olması gerekmez
+ * \param symbols Ad tablosu; kimlikler buradan çözülür
+ */
+void StreamCodegen::statement(int label, const Stmt* st, const Interner& symbols){
+    for (std::size_t id = refs_.size(); id < symbols.size(); ++id)
+        refs_.push_back("var[\"" + std::string(symbols.name(static_cast<SymbolId>(id))) + "\"]");
+    if (!started_){
+        started_ = true;
+        emit_default_prologue(out_);
+        out_ << "  int pc = " << label << ";\n";
+        out_ << "  while(true){\n";
+        out_ << "    switch(pc){\n";
+    } else {
+        if (exit_case_){ out_ << "    case " << exit_case_ << ":\n"; exit_case_ = 0; }
+        // FOR'un çıkışı henüz bilinmez; eşleşen NEXT'ten sonraki deyim bu ek `case` ile etiketlenir.
+        if (pending_.stmt_kind[0] == StmtKind::For) pending_.stmt_a[0] = for_exit_case(label);
+        emit_case(out_, pending_, VarRefs{refs_, nullptr, true}, 0, label, false);
+        if (pending_.stmt_kind[0] == StmtKind::Next) exit_case_ = for_exit_case(pending_.stmt_a[0]);
+    }
+    pending_.expr_kind.clear(); pending_.expr_op.clear(); pending_.expr_a.clear(); pending_.expr_b.clear();
+    pending_.numbers.clear(); pending_.labels.clear(); pending_.stmt_kind.clear();
+    pending_.stmt_a.clear(); pending_.stmt_b.clear(); pending_.items.clear();
+    append_stmt(pending_, label, st);
+}
+
+/**
+ * \brief Son deyimi ve programın kapanışını yazar.
+ */
+void StreamCodegen::finish(){
+    if (!started_){
+        emit_default_prologue(out_);
+        out_ << "  return 0;\n}";
+        return;
+    }
+    if (exit_case_){ out_ << "    case " << exit_case_ << ":\n"; exit_case_ = 0; }
+    emit_case(out_, pending_, VarRefs{refs_, nullptr, true}, 0, -1, false);
+    emit_dispatch_tail(out_);
+    out_ << "}\n";
 }
 
 } // namespace translator
@@ -6,11 +6,44 @@
  * @version 1.0
  */
 #pragma once
+#include <cstddef>
 #include <string>
+#include <string_view>
+#include <vector>
 #include "translator/ast.h"
+#include "translator/emitter.h"
+#include "translator/flat_ast.h"
 
 namespace translator {
 
+/**
+ * @brief Üretilen programda değişkenlerin saklanma biçimi
+ */
+enum class VarStorage {
+    Map,     ///< `std::unordered_map<std::string,double> var`; her erişimde ad özeti
+    Slots,   ///< `double slots[N]`; her değişken derleme zamanı sabit indeksli bir yuva
+    Locals   ///< Her değişken için ayrı bir `double v_AD` yerel değişkeni
+};
+
+/**
+ * @brief Üretilen programın kontrol akışı biçimi
+ */
+enum class ControlFlow {
+    Dispatch,    ///< Her deyim `while(true){switch(pc)}` içinde bir `case`
+    Blocks,      ///< Temel bloklar düz akar; atlamalar `goto`, yalnızca RETURN `switch` kullanır
+    Structured   ///< Döngüler `while`, dallar `if`/`else`; kalanlar `goto`
+};
+
+/**
+ * @brief Kod üretimi seçenekleri
+ */
+struct CodegenOptions {
+    VarStorage vars = VarStorage::Map;         ///< Değişken saklama biçimi
+    ControlFlow flow = ControlFlow::Dispatch;  ///< Kontrol akışı biçimi
+    bool optimize = false;                     ///< Program sürümünde önce optimize() ve eliminate_dead_code() uygulanır
+    bool typed = false;                        ///< infer_types() ile tamsayı kaldığı kanıtlanan değişkenler `std::int64_t` olur
+};
+
 /**
  * @brief C++ kaynak çıktısı üreten yardımcı sınıf
  * 
@@ -22,9 +55,111 @@ public:
     /**
      * @brief Verilen Program'dan C++ kodu üretir
      * @param p Çevrilecek program AST'i
+     * @param opts Üretim seçenekleri
      * @return Üretilen C++ kaynak kodu
      */
-    static std::string emit_cpp(const Program& p);
+    static std::string emit_cpp(const Program& p, const CodegenOptions& opts = {});
+
+    /**
+     * @brief Verilen Program'dan üretilen C++ kodunu tampona yazar
+     * @param p Çevrilecek program AST'i
+     * @param opts Üretim seçenekleri
+     * @param out Çıktı tamponu; dosya kipindeyse çıktı parça parça dosyaya gider
+     */
+    static void emit_cpp(const Program& p, const CodegenOptions& opts, Emitter& out);
+
+    /**
+     * @brief Düz (indeks tabanlı) programdan C++ kodu üretir
+     * @param p Çevrilecek düz program
+     * @param opts Üretim seçenekleri
+     * @return Üretilen C++ kaynak kodu; aynı programın Program
+     *         sürümüyle birebir aynıdır
+     */
+    static std::string emit_cpp(const FlatProgram& p, const CodegenOptions& opts = {});
+
+    /**
+     * @brief Düz programdan üretilen C++ kodunu tampona yazar
+     * @param p Çevrilecek düz program
+     * @param opts Üretim seçenekleri
+     * @param out Çıktı tamponu
+     */
+    static void emit_cpp(const FlatProgram& p, const CodegenOptions& opts, Emitter& out);
+
+    /**
+     * @brief Varsayılan kipte (Dispatch, Map) tek bir deyimin `case` bloğunu üretir
+     * @param p Düz program
+     * @param i Deyim indeksi
+     * @param next_label Sonraki deyimin etiketi; son deyimde -1
+     * @return Blok metni; yalnızca deyime ve next_label'a bağlıdır
+     */
+    static std::string emit_dispatch_case(const FlatProgram& p, std::size_t i, int next_label);
+
+    /**
+     * @brief Deyimin `case` bloğunun başvurduğu atlama hedefi
+     * @param p Düz program
+     * @param i Deyim indeksi
+     * @return GOTO / IF / GOSUB hedef etiketi; diğer deyimlerde -1
+     */
+    static int dispatch_target(const FlatProgram& p, std::size_t i);
+
+    /**
+     * @brief emit_dispatch_case() bloklarını tam bir programa birleştirir
+     * @param labels Program sırasıyla etiketler
+     * @param targets Blokların dispatch_target() değerleri (sıra önemsiz)
+     * @param cases Program sırasıyla bloklar
+     * @return Aynı programın varsayılan seçeneklerle emit_cpp() çıktısı
+     *
+     * Etiketler `enum` ile deyim numaralarına bağlanır; programda olmayan
+     * hedefler programı bitiren `END` değerini alır.
+     */
+    static std::string assemble_dispatch(const std::vector<int>& labels, const std::vector<int>& targets, const std::vector<std::string_view>& cases);
+};
+
+/**
+ * @brief Deyimleri çözümlendikleri anda dispatch kipinde yazan kod üretici
+ *
+ * Parser::parse_each() alıcısı olarak kullanılır. Bir deyimin `case` bloğu
+ * sonraki etiketi gerektirdiğinden yalnızca bir deyim bekletilir; çıktı
+ * Emitter üzerinden parça parça boşaltılır ve bellek kullanımı programın
+ * boyuna bağlı değildir.
+ *
+ * Tüm etiketler önceden bilinmediği için `enum` yerine etiketlerin kendisi
+ * yazılır (`case 10:`, `pc = 20;`); programda olmayan hedefler `default`
+ * ile programı bitirir. Anlam, varsayılan seçeneklerle (Dispatch, Map)
+ * Codegen::emit_cpp çıktısıyla aynıdır.
+ *
+ * FOR yazılırken eşleşen NEXT'ten sonraki etiket henüz bilinmez; FOR
+ * sentetik bir negatif `case`'e atlar ve o etiket NEXT'ten sonraki deyimin
+ * bloğuna ikinci bir `case` olarak eklenir. Sınır ve adım önceden
+ * bildirilemediğinden `var` haritasında BASIC adı olamayan anahtarlarla
+ * (`var["to 20"]`) tutulur.
+ */
+class StreamCodegen {
+    Emitter& out_;                    ///< Çıktı
+    FlatProgram pending_;             ///< Sonraki etiketi beklenen deyim
+    std::vector<std::string> refs_;   ///< Kimlik başına değişken erişim metni
+    bool started_ = false;            ///< Giriş kısmı yazıldı mı?
+    int exit_case_ = 0;               ///< Bekleyen deyimin önüne yazılacak FOR çıkışı `case`'i (0: yok; çıkışlar hep negatiftir)
+
+public:
+    /**
+     * @brief Üreticiyi oluşturur
+     * @param out Çıktı tamponu; üreticiden uzun yaşamalıdır
+     */
+    explicit StreamCodegen(Emitter& out): out_(out) {}
+
+    /**
+     * @brief Sıradaki deyimi alır
+     * @param label Deyimin etiketi
+     * @param st Deyim; yalnızca çağrı süresince geçerli olması yeterlidir
+     * @param symbols Çözümleyicinin ad tablosu
+     */
+    void statement(int label, const Stmt* st, const Interner& symbols);
+
+    /**
+     * @brief Bekleyen deyimi ve programın kapanışını yazar
+     */
+    void finish();
 };
 
 } // namespace translator
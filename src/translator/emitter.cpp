@@ -0,0 +1,105 @@
+/**
+ * @file emitter.cpp
+ * @brief Emitter uygulaması: tampon büyütme ve dosya tanımlayıcısına boşaltma.
+ */
+#include "translator/emitter.h"
+#include <cerrno>
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace translator {
+
+namespace {
+
+/**
+ * \brief Tamponun tamamını dosya tanımlayıcısına yazar.
+ * \return Tüm baytlar yazıldıysa true
+ */
+bool write_all(int fd, const char* p, std::size_t n){
+    while (n > 0){
+#if defined(_WIN32)
+        int w = ::_write(fd, p, static_cast<unsigned>(n > (1u << 30) ? (1u << 30) : n));
+#else
+        ssize_t w = ::write(fd, p, n);
+#endif
+        if (w < 0){ if (errno == EINTR) continue; return false; }
+        p += w; n -= static_cast<std::size_t>(w);
+    }
+    return true;
+}
+
+} // namespace
+
+/**
+ * \brief Çıktı dosyasını açar.
+ * \param path Çıktı yolu ("-" standart çıktı)
+ * \param chunk Boşaltma eşiği
+ * \return Dosyanın sahibi olan tampon
+ */
+Emitter Emitter::open(const std::string& path, std::size_t chunk){
+    if (path == "-") return Emitter(1, chunk);
+#if defined(_WIN32)
+    int fd = ::_open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+    if (fd < 0) throw std::runtime_error("Cannot open output: " + path);
+    Emitter e(fd, chunk);
+    e.owns_fd_ = true;
+    return e;
+}
+
+/**
+ * \brief Kapasiteyi en az need bayt boş yer kalacak şekilde iki katına çıkarır.
+ * \param need Gereken boş yer
+ */
+void Emitter::grow(std::size_t need){
+    std::size_t cap = buf_.size() ? buf_.size() : 64;
+    while (cap < len_ + need) cap *= 2;
+    buf_.resize(cap);
+}
+
+/** \brief Dolu kısmı dosyaya yazar ve tamponu başa sarar. */
+void Emitter::drain(){
+    if (!write_all(fd_, buf_.data(), len_)) ok_ = false;
+    flushed_ += len_;
+    len_ = 0;
+}
+
+/** \brief Kalan çıktıyı boşaltır; sahip olunan dosyayı kapatır. */
+void Emitter::release() noexcept {
+    if (fd_ < 0) return;
+    if (len_) drain();
+#if defined(_WIN32)
+    if (owns_fd_) ::_close(fd_);
+#else
+    if (owns_fd_) ::close(fd_);
+#endif
+    fd_ = -1; owns_fd_ = false;
+}
+
+Emitter::Emitter(Emitter&& o) noexcept
+    : buf_(std::move(o.buf_)), len_(o.len_), flushed_(o.flushed_), chunk_(o.chunk_), fd_(o.fd_), owns_fd_(o.owns_fd_), ok_(o.ok_) {
+    o.len_ = 0; o.fd_ = -1; o.owns_fd_ = false;
+}
+
+Emitter& Emitter::operator=(Emitter&& o) noexcept {
+    if (this != &o){
+        release();
+        buf_ = std::move(o.buf_); len_ = o.len_; flushed_ = o.flushed_; chunk_ = o.chunk_;
+        fd_ = o.fd_; owns_fd_ = o.owns_fd_; ok_ = o.ok_;
+        o.len_ = 0; o.fd_ = -1; o.owns_fd_ = false;
+    }
+    return *this;
+}
+
+} // namespace translator
@@ -0,0 +1,151 @@
+/**
+ * @file emitter.h
+ * @brief Kod üretimi için bellek ayırmadan büyüyen, isteğe bağlı olarak dosyaya boşaltılan çıktı tamponu
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace translator {
+
+/**
+ * @brief std::ostringstream yerine kullanılan çıktı tamponu
+ *
+ * Bellek kipinde metin tek bir std::string içinde birikir; kapasite iki
+ * katına çıkarılarak önceden ayrılır ve take() içeriği kopyalamadan
+ * devreder. Dosya kipinde tampon `chunk` baytı aştıkça dosya
+ * tanımlayıcısına yazılır; çıktının tamamı hiçbir zaman bellekte tutulmaz.
+ *
+ * Sayılar std::to_chars ile yazılır: yerel ayardan bağımsızdır ve
+ * double değerler geri okunduğunda aynı değeri veren en kısa biçimi alır
+ * (tamsayılar ondalıksız). Taşınabilir, kopyalanamaz.
+ */
+class Emitter {
+    std::string buf_;            ///< Tampon; size() kapasitedir, len_ kadarı doludur
+    std::size_t len_ = 0;        ///< Tampondaki geçerli bayt sayısı
+    std::size_t flushed_ = 0;    ///< Dosyaya yazılmış bayt sayısı
+    std::size_t chunk_ = 0;      ///< Dosya kipinde boşaltma eşiği (0: bellek kipi)
+    int fd_ = -1;                ///< Hedef dosya tanımlayıcısı (bellek kipinde -1)
+    bool owns_fd_ = false;       ///< fd_ yıkıcıda kapatılsın mı?
+    bool ok_ = true;             ///< Bir yazma hatası oldu mu?
+
+    void grow(std::size_t need);
+    void drain();
+    void release() noexcept;
+
+    /** @brief n bayt için yer açar ve yazma konumunu döndürür. */
+    char* reserve_bytes(std::size_t n){
+        if (len_ + n > buf_.size()) grow(n);
+        return &buf_[len_];
+    }
+
+public:
+    /// Dosya kipinde varsayılan boşaltma eşiği (bayt).
+    static constexpr std::size_t kDefaultChunk = 1u << 16;
+
+    /**
+     * @brief Bellekte biriktiren tampon oluşturur
+     * @param reserve Başlangıç kapasitesi
+     */
+    explicit Emitter(std::size_t reserve = 4096){ buf_.resize(reserve); }
+
+    /**
+     * @brief Dosya tanımlayıcısına parça parça yazan tampon oluşturur
+     * @param fd Açık, yazılabilir dosya tanımlayıcısı; sahipliği alınmaz
+     * @param chunk Boşaltma eşiği
+     */
+    Emitter(int fd, std::size_t chunk): chunk_(chunk ? chunk : kDefaultChunk), fd_(fd) { buf_.resize(chunk_ * 2); }
+
+    /**
+     * @brief Dosyayı yazmak için açar (varsa kesilir)
+     * @param path Çıktı yolu; "-" standart çıktı
+     * @param chunk Boşaltma eşiği
+     * @return Dosya kipinde tampon; dosya yıkıcıda boşaltılıp kapatılır
+     * @throws std::runtime_error dosya açılamazsa
+     */
+    static Emitter open(const std::string& path, std::size_t chunk = kDefaultChunk);
+
+    ~Emitter(){ release(); }
+    Emitter(Emitter&& o) noexcept;
+    Emitter& operator=(Emitter&& o) noexcept;
+    Emitter(const Emitter&) = delete;
+    Emitter& operator=(const Emitter&) = delete;
+
+    /** @brief Metin ekler. */
+    Emitter& operator<<(std::string_view s){
+        std::memcpy(reserve_bytes(s.size()), s.data(), s.size());
+        len_ += s.size();
+        if (len_ >= chunk_ && fd_ >= 0) drain();
+        return *this;
+    }
+    /** @brief C dizesi ekler. */
+    Emitter& operator<<(const char* s){ return *this << std::string_view(s); }
+    /** @brief std::string ekler. */
+    Emitter& operator<<(const std::string& s){ return *this << std::string_view(s); }
+    /** @brief Tek karakter ekler. */
+    Emitter& operator<<(char c){
+        *reserve_bytes(1) = c; ++len_;
+        if (len_ >= chunk_ && fd_ >= 0) drain();
+        return *this;
+    }
+    /** @brief Tamsayıyı ondalık olarak ekler. */
+    template <class T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, bool>, int> = 0>
+    Emitter& operator<<(T v){
+        char* p = reserve_bytes(24);
+        len_ = static_cast<std::size_t>(std::to_chars(p, p + 24, v).ptr - buf_.data());
+        if (len_ >= chunk_ && fd_ >= 0) drain();
+        return *this;
+    }
+    /** @brief Sayıyı geri okunduğunda aynı değeri veren en kısa biçimde ekler (`7.0` → `7`; C++ `double` sabiti gerekiyorsa `.0` eklemek çağırana kalır). */
+    Emitter& operator<<(double v){
+        char* p = reserve_bytes(32);
+        len_ = static_cast<std::size_t>(std::to_chars(p, p + 32, v).ptr - buf_.data());
+        if (len_ >= chunk_ && fd_ >= 0) drain();
+        return *this;
+    }
+
+    /**
+     * @brief Bellek kipinde en az n baytlık boş yer ayırır
+     * @param n Beklenen ek çıktı boyu
+     */
+    void reserve(std::size_t n){ if (fd_ < 0 && len_ + n > buf_.size()) grow(n); }
+
+    /**
+     * @brief Tamponu dosyaya yazar (bellek kipinde etkisiz)
+     * @return Şimdiye kadarki tüm yazmalar başarılıysa true
+     */
+    bool flush(){ if (fd_ >= 0 && len_) drain(); return ok_; }
+
+    /**
+     * @brief Henüz boşaltılmamış metni yazmadan atar
+     *
+     * Yıkıcı ya da taşıma ataması tamponu önce dosyaya boşalttığı için
+     * yarım kalan çıktı bununla bırakılır. Daha önce boşaltılmış parçalar
+     * geri alınamaz.
+     */
+    void discard() noexcept { len_ = 0; }
+
+    /**
+     * @brief Bellek kipinde biriken metni kopyalamadan devreder
+     * @return Üretilen metin; tampon boşalır
+     */
+    std::string take(){ buf_.resize(len_); len_ = 0; return std::move(buf_); }
+
+    /** @brief Henüz devredilmemiş / boşaltılmamış metin. */
+    std::string_view view() const noexcept { return std::string_view(buf_.data(), len_); }
+    /** @brief Dosyaya yazılmış bayt (bellek kipinde 0). */
+    std::size_t flushed() const noexcept { return flushed_; }
+    /** @brief Şimdiye kadar üretilen toplam bayt. */
+    std::size_t size() const noexcept { return flushed_ + len_; }
+    /** @brief Yazma hatası olmadıysa true. */
+    bool ok() const noexcept { return ok_; }
+};
+
+} // namespace translator
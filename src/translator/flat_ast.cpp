@@ -0,0 +1,146 @@
+/**
+ * @file flat_ast.cpp
+ * @brief Program'dan FlatProgram'a dönüştürme.
+ */
+#include "translator/flat_ast.h"
+#include <utility>
+#include <vector>
+
+namespace translator {
+
+namespace {
+
+/** \brief Dönüştürme sırasında hedef programı tutar. */
+struct Flattener {
+    FlatProgram& out;
+
+    explicit Flattener(FlatProgram& o): out(o) {}
+
+    /** \brief Bir ifade düğümü ekler ve indeksini döndürür. */
+    NodeIndex push(ExprKind k, char op, NodeIndex a, NodeIndex b){
+        NodeIndex idx = static_cast<NodeIndex>(out.expr_kind.size());
+        out.expr_kind.push_back(k); out.expr_op.push_back(op);
+        out.expr_a.push_back(a); out.expr_b.push_back(b);
+        return idx;
+    }
+
+    /// expr() için yeniden kullanılan yığınlar: (düğüm, çocukları yazıldı mı) ve yazılan kökler.
+    std::vector<std::pair<const Expr*, bool>> todo;
+    std::vector<NodeIndex> done;
+
+    /** \brief Yaprak düğümü yazar. */
+    NodeIndex leaf(const Expr* e){
+        if (e->kind() == ExprKind::Variable)
+            return push(ExprKind::Variable, 0, static_cast<NodeIndex>(static_cast<const VariableExpr*>(e)->id), -1);
+        NodeIndex n = static_cast<NodeIndex>(out.numbers.size());
+        out.numbers.push_back(static_cast<const NumberExpr*>(e)->value);
+        return push(ExprKind::Number, 0, n, -1);
+    }
+
+    /**
+     * \brief İfade ağacını alt-önce sırada düz dizilere yazar.
+     * \param e Kaynak ifade
+     * \return Kök düğümün indeksi
+     *
+     * Açık yığınla gezilir; ağaç derinliği çağrı yığınını tüketmez.
+     */
+    NodeIndex expr(const Expr* e){
+        if (e->kind() != ExprKind::Binary) return leaf(e);
+        todo.assign(1, {e, false});
+        done.clear();
+        while (!todo.empty()){
+            auto [x, expanded] = todo.back(); todo.pop_back();
+            if (x->kind() != ExprKind::Binary){ done.push_back(leaf(x)); continue; }
+            auto* b = static_cast<const BinaryExpr*>(x);
+            if (!expanded){
+                // Sol alt ağaç önce yazılır: yığına ters sırada girer.
+                todo.push_back({x, true}); todo.push_back({b->rhs, false}); todo.push_back({b->lhs, false});
+                continue;
+            }
+            const NodeIndex r = done.back(); done.pop_back();
+            done.back() = push(ExprKind::Binary, b->op, done.back(), r);
+        }
+        return done.back();
+    }
+
+    /** \brief Bir deyim satırı ekler. */
+    void stmt(StmtKind k, NodeIndex a, NodeIndex b){
+        out.stmt_kind.push_back(k); out.stmt_a.push_back(a); out.stmt_b.push_back(b);
+    }
+
+    /** \brief Bir deyimi etiketiyle birlikte ekler. */
+    void statement(int label, const Stmt* st){
+        out.labels.push_back(label);
+        switch (st->kind()){
+            case StmtKind::Let: {
+                auto* s = static_cast<const LetStmt*>(st);
+                stmt(StmtKind::Let, static_cast<NodeIndex>(s->id), expr(s->expr));
+                break;
+            }
+            case StmtKind::Print: {
+                auto* s = static_cast<const PrintStmt*>(st);
+                // İfadeler items'a dokunmadığından kökler doğrudan sona eklenebilir.
+                NodeIndex first = static_cast<NodeIndex>(out.items.size());
+                for (const Expr* e : s->items) out.items.push_back(expr(e));
+                stmt(StmtKind::Print, first, static_cast<NodeIndex>(s->items.size()));
+                break;
+            }
+            case StmtKind::Input: stmt(StmtKind::Input, static_cast<NodeIndex>(static_cast<const InputStmt*>(st)->id), -1); break;
+            case StmtKind::Goto: stmt(StmtKind::Goto, static_cast<const GotoStmt*>(st)->target, -1); break;
+            case StmtKind::IfGoto: {
+                auto* s = static_cast<const IfGotoStmt*>(st);
+                stmt(StmtKind::IfGoto, s->target, expr(s->cond));
+                break;
+            }
+            case StmtKind::Gosub: stmt(StmtKind::Gosub, static_cast<const GosubStmt*>(st)->target, -1); break;
+            case StmtKind::Return: stmt(StmtKind::Return, -1, -1); break;
+            case StmtKind::For: {
+                auto* s = static_cast<const ForStmt*>(st);
+                NodeIndex var = push(ExprKind::Variable, 0, static_cast<NodeIndex>(s->id), -1);
+                NodeIndex start = expr(s->start), limit = expr(s->limit);
+                NodeIndex step;
+                if (s->step) step = expr(s->step);
+                else { step = push(ExprKind::Number, 0, static_cast<NodeIndex>(out.numbers.size()), -1); out.numbers.push_back(1.0); }
+                NodeIndex first = static_cast<NodeIndex>(out.items.size());
+                for (NodeIndex e : {var, start, limit, step}) out.items.push_back(e);
+                stmt(StmtKind::For, s->exit, first);
+                break;
+            }
+            case StmtKind::Next: {
+                auto* s = static_cast<const NextStmt*>(st);
+                stmt(StmtKind::Next, s->body, static_cast<NodeIndex>(s->id));
+                break;
+            }
+        }
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Tek bir deyimi düz programın sonuna ekler.
+ * \param out Hedef düz program
+ * \param label Deyimin etiketi
+ * \param st Deyim
+ */
+void append_stmt(FlatProgram& out, int label, const Stmt* st){
+    Flattener(out).statement(label, st);
+}
+
+/**
+ * \brief İşaretçi tabanlı Program'ı düz biçime dönüştürür.
+ * \param p Kaynak program
+ * \return Düz program
+ */
+FlatProgram flatten(const Program& p){
+    FlatProgram out;
+    out.names.assign(p.symbols.names().begin(), p.symbols.names().end());
+    out.labels.reserve(p.stmts.size());
+    out.stmt_kind.reserve(p.stmts.size()); out.stmt_a.reserve(p.stmts.size()); out.stmt_b.reserve(p.stmts.size());
+    Flattener f(out);
+    for (std::size_t i=0;i<p.stmts.size();++i) f.statement(p.labels[i], p.stmts[i]);
+    out.index = current_index(p.index, p.labels);
+    return out;
+}
+
+} // namespace translator
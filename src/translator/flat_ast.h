@@ -0,0 +1,84 @@
+/**
+ * @file flat_ast.h
+ * @brief İndeks tabanlı, dizi-yapısı (struct-of-arrays) biçiminde düz AST
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "translator/ast.h"
+
+namespace translator {
+
+/// Düz AST içindeki düğüm indeksi.
+using NodeIndex = std::int32_t;
+
+/**
+ * @brief İşaretçisiz, bitişik dizilerde tutulan program
+ * 
+ * İfadeler alt-önce (post-order) sırada saklanır: bir ikili ifadenin
+ * işlenenleri her zaman kendisinden küçük indekslidir. Her alan ayrı bir
+ * dizidir; bir geçiş yalnızca ihtiyaç duyduğu dizileri okur.
+ *
+ * Alanların anlamı düğüm türüne göre değişir:
+ * | Tür             | `*_a`                     | `*_b`                    |
+ * |-----------------|---------------------------|--------------------------|
+ * | Number          | `numbers` indeksi         | -                        |
+ * | Variable        | `names` indeksi           | -                        |
+ * | Binary          | sol ifade                 | sağ ifade                |
+ * | Let             | `names` indeksi           | ifade                    |
+ * | Print           | `items` içindeki ilk öğe  | öğe sayısı               |
+ * | Input           | `names` indeksi           | -                        |
+ * | Goto / Gosub    | hedef etiket              | -                        |
+ * | IfGoto          | hedef etiket              | koşul ifadesi            |
+ * | For             | çıkış etiketi             | `items` içindeki ilk öğe |
+ * | Next            | gövde etiketi             | `names` indeksi          |
+ *
+ * FOR'un dört öğesi sırasıyla döngü değişkeni (Variable düğümü),
+ * başlangıç, sınır ve adımdır; adım yazılmadıysa 1 sabitidir. Bir
+ * döngünün kimliği gövde etiketidir: FOR'dan sonraki deyimin etiketi,
+ * NEXT'in döndüğü etiketle aynıdır. Üretilen kod ve bayt kodu sınır ile
+ * adımı bu kimlikle adlandırılan gizli değişkenlerde tutar.
+ */
+struct FlatProgram {
+    std::vector<ExprKind> expr_kind;   ///< İfade türleri
+    std::vector<char> expr_op;         ///< İkili işlem operatörü (diğerlerinde 0)
+    std::vector<NodeIndex> expr_a;     ///< İfade birinci alanı
+    std::vector<NodeIndex> expr_b;     ///< İfade ikinci alanı
+    std::vector<double> numbers;       ///< Sayısal sabit havuzu
+    std::vector<std::string> names;    ///< Değişken adları (Program::symbols kimlik sırasıyla)
+
+    std::vector<int> labels;           ///< Satır etiketleri
+    std::vector<StmtKind> stmt_kind;   ///< Deyim türleri
+    std::vector<NodeIndex> stmt_a;     ///< Deyim birinci alanı
+    std::vector<NodeIndex> stmt_b;     ///< Deyim ikinci alanı
+    std::vector<NodeIndex> items;      ///< PRINT ve FOR öğelerinin ifade indeksleri
+    LabelIndex index;                  ///< Etiket → deyim indeksi; labels değişirse yeniden kurulur
+
+    /** @brief Deyim sayısı. */
+    std::size_t size() const noexcept { return stmt_kind.size(); }
+    /** @brief Program boş mu? */
+    bool empty() const noexcept { return stmt_kind.empty(); }
+};
+
+/**
+ * @brief İşaretçi tabanlı Program'ı düz biçime dönüştürür
+ * @param p Kaynak program
+ * @return Aynı programın düz gösterimi; ad indeksleri Program::symbols
+ *         kimlikleriyle aynıdır
+ */
+FlatProgram flatten(const Program& p);
+
+/**
+ * @brief Tek bir deyimi ve ifadelerini düz programın sonuna ekler
+ * @param out Hedef program; `names` ve `index` güncellenmez
+ * @param label Deyimin etiketi
+ * @param st Eklenecek deyim
+ */
+void append_stmt(FlatProgram& out, int label, const Stmt* st);
+
+} // namespace translator
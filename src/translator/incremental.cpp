@@ -0,0 +1,240 @@
+/**
+ * @file incremental.cpp
+ * @brief Artımlı çeviri önbelleğinin uygulaması.
+ */
+#include "translator/incremental.h"
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include "translator/codegen.h"
+#include "translator/flat_ast.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+
+namespace translator {
+
+namespace {
+
+/// Önbellek dosyasının ilk satırının başı; dosya biçimi değişirse sürüm artırılır.
+constexpr const char* kMagic = "basic-translator-cache 3";
+
+/// Kod üretimi parmak izi için her deyim türünü ve sayı biçimlerini içeren örnek.
+constexpr const char* kProbe =
+    "10 LET A = 7 / 2 + B * 1.5 - 1E20\n"
+    "20 PRINT A, A < 3, A >= B, A <> B\n"
+    "30 INPUT B\n"
+    "40 IF A = B THEN 10\n"
+    "50 GOSUB 70\n"
+    "60 GOTO 80\n"
+    "70 RETURN\n"
+    "80 PRINT 1234567, 0.25\n";
+
+/** \brief Bir kaynak satırı ve etiketi. */
+struct Line {
+    std::string_view text;  ///< Baştaki ve sondaki boşluklardan arındırılmış metin
+    int label;              ///< Satır başındaki etiket
+};
+
+/** \brief 64 bit FNV-1a özetine bayt ekler. */
+std::uint64_t fnv1a(std::uint64_t h, const void* data, std::size_t n){
+    auto* p = static_cast<const unsigned char*>(data);
+    for (std::size_t i=0;i<n;++i){ h ^= p[i]; h *= 0x100000001b3ull; }
+    return h;
+}
+
+/**
+ * \brief Satır metni ile sonraki etiketten blok anahtarını hesaplar.
+ * \param text Satır metni
+ * \param next_label Sonraki satırın etiketi; son satırda -1
+ */
+std::uint64_t block_key(std::string_view text, int next_label){
+    std::uint64_t h = fnv1a(0xcbf29ce484222325ull, text.data(), text.size());
+    const char sep = '\n';
+    h = fnv1a(h, &sep, 1);
+    return fnv1a(h, &next_label, sizeof next_label);
+}
+
+bool is_space(char c){ return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v'; }
+
+/**
+ * \brief Kaynağı boş olmayan satırlara böler ve etiketlerini okur.
+ * \param src Kaynak
+ * \param[out] out Satırlar
+ * \return Her satır bir etiketle başlıyorsa true
+ */
+bool split_lines(std::string_view src, std::vector<Line>& out){
+    std::size_t pos = 0;
+    while (pos < src.size()){
+        std::size_t nl = src.find('\n', pos);
+        if (nl == std::string_view::npos) nl = src.size();
+        std::size_t b = pos, e = nl;
+        pos = nl + 1;
+        while (b < e && is_space(src[b])) ++b;
+        while (e > b && is_space(src[e-1])) --e;
+        if (b == e) continue;
+        std::string_view text = src.substr(b, e - b);
+        int label = 0;
+        std::size_t k = 0;
+        // Dokuz basamak int'e taşmadan sığar; daha uzun etiketler normal yoldan çevrilir.
+        while (k < text.size() && k < 9 && text[k] >= '0' && text[k] <= '9') label = label * 10 + (text[k++] - '0');
+        if (k == 0 || (k < text.size() && text[k] >= '0' && text[k] <= '9')) return false;
+        out.push_back({text, label});
+    }
+    return true;
+}
+
+/**
+ * \brief Tek bir satırı çözümleyip `case` bloğunu üretir.
+ * \param line Satır
+ * \param next_label Sonraki satırın etiketi
+ * \param[out] block Üretilen blok
+ * \return Satır tek başına tam olarak bir deyim ve aynı etiketi verdiyse true
+ */
+bool emit_line(const Line& line, int next_label, TranslationCache::Block& block){
+    try {
+        Lexer lx{std::string(line.text)};
+        Parser ps(lx);
+        const Program prog = ps.parseProgram();
+        if (prog.stmts.size() != 1 || prog.labels[0] != line.label) return false;
+        const FlatProgram flat = flatten(prog);
+        block.text = Codegen::emit_dispatch_case(flat, 0, next_label);
+        block.target = Codegen::dispatch_target(flat, 0);
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+/**
+ * \brief Önbellek dosyasının ilk satırı.
+ *
+ * kMagic'e kProbe satırlarından üretilen blokların özeti eklenir. Üretilen
+ * kod değişen bir sürümün yazdığı bloklar böylece sürüm elle artırılmasa da
+ * yüklenmez.
+ */
+const std::string& cache_header(){
+    static const std::string header = []{
+        std::uint64_t h = 0xcbf29ce484222325ull;
+        std::vector<Line> lines;
+        split_lines(kProbe, lines);
+        for (std::size_t i=0;i<lines.size();++i){
+            TranslationCache::Block block;
+            if (!emit_line(lines[i], i + 1 < lines.size() ? lines[i+1].label : -1, block)) continue;
+            h = fnv1a(h, block.text.data(), block.text.size());
+            h = fnv1a(h, &block.target, sizeof block.target);
+        }
+        char hex[17];
+        std::snprintf(hex, sizeof hex, "%016llx", static_cast<unsigned long long>(h));
+        return std::string(kMagic) + ' ' + hex;
+    }();
+    return header;
+}
+
+} // namespace
+
+/**
+ * \brief Önbelleği dosyadan yükler.
+ * \param path Önbellek dosyası
+ * \return Başarılıysa true
+ *
+ * Biçim: sihirli satır ve kod üretimi parmak izi, ardından her blok için `anahtar(hex) uzunluk hedef\n`
+ * ve uzunluk kadar bayt.
+ */
+bool TranslationCache::load(const std::string& path){
+    blocks_.clear();
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::string magic;
+    if (!std::getline(in, magic) || magic != cache_header()) return false;
+    std::unordered_map<std::uint64_t, Block> blocks;
+    std::string header;
+    while (std::getline(in, header)){
+        unsigned long long key = 0, len = 0;
+        Block block;
+        if (std::sscanf(header.c_str(), "%llx %llu %d", &key, &len, &block.target) != 3) return false;
+        block.text.resize(static_cast<std::size_t>(len));
+        if (!in.read(&block.text[0], static_cast<std::streamsize>(len))) return false;
+        blocks.emplace(static_cast<std::uint64_t>(key), std::move(block));
+    }
+    blocks_ = std::move(blocks);
+    return true;
+}
+
+/**
+ * \brief Önbelleği dosyaya yazar.
+ * \param path Önbellek dosyası
+ * \return Başarılıysa true
+ */
+bool TranslationCache::save(const std::string& path) const {
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        out << cache_header() << '\n';
+        char header[64];
+        for (const auto& kv : blocks_){
+            int n = std::snprintf(header, sizeof header, "%016llx %llu %d\n", static_cast<unsigned long long>(kv.first),
+                                  static_cast<unsigned long long>(kv.second.text.size()), kv.second.target);
+            out.write(header, n);
+            out << kv.second.text;
+        }
+        if (!out.flush()) return false;
+    }
+    std::remove(path.c_str());
+    return std::rename(tmp.c_str(), path.c_str()) == 0;
+}
+
+/**
+ * \brief Kaynağı çevirir.
+ * \param source BASIC kaynağı
+ * \return Üretilen C++ kaynak kodu
+ */
+std::string TranslationCache::translate(std::string_view source){
+    stats_ = {};
+    std::vector<Line> lines;
+    std::unordered_map<std::uint64_t, Block> used;
+    bool ok = split_lines(source, lines);
+    std::vector<std::string_view> cases;
+    std::vector<int> labels, targets;
+    cases.reserve(lines.size()); labels.reserve(lines.size()); targets.reserve(lines.size());
+    for (std::size_t i=0;ok && i<lines.size();++i){
+        const int next_label = i + 1 < lines.size() ? lines[i+1].label : -1;
+        const std::uint64_t key = block_key(lines[i].text, next_label);
+        auto it = used.find(key);
+        if (it == used.end()){
+            auto cached = blocks_.find(key);
+            if (cached != blocks_.end()){
+                it = used.emplace(key, std::move(cached->second)).first;
+                blocks_.erase(cached);
+                ++stats_.hits;
+            } else {
+                Block block;
+                if (!emit_line(lines[i], next_label, block)) { ok = false; break; }
+                it = used.emplace(key, std::move(block)).first;
+                ++stats_.misses;
+            }
+        } else {
+            ++stats_.hits;
+        }
+        cases.push_back(it->second.text);
+        labels.push_back(lines[i].label);
+        targets.push_back(it->second.target);
+    }
+    if (!ok){
+        // Eski ve yeni blokları koruyup tüm dosyayı normal yoldan çevir.
+        for (auto& kv : used) blocks_.insert(std::move(kv));
+        stats_ = {};
+        stats_.misses = lines.size();
+        stats_.fallback = true;
+        Lexer lx{std::string(source)};
+        Parser ps(lx);
+        return Codegen::emit_cpp(ps.parseProgram());
+    }
+    std::string code = Codegen::assemble_dispatch(labels, targets, cases);
+    // Yalnızca bu çeviride kullanılan bloklar saklanır.
+    blocks_ = std::move(used);
+    return code;
+}
+
+} // namespace translator
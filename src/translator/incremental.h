@@ -0,0 +1,79 @@
+/**
+ * @file incremental.h
+ * @brief Deyim özetleriyle anahtarlanan, diskte saklanan artımlı çeviri önbelleği
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace translator {
+
+/**
+ * @brief Son çevirinin önbellek sayaçları
+ */
+struct CacheStats {
+    std::size_t hits = 0;       ///< Önbellekten alınan `case` blokları
+    std::size_t misses = 0;     ///< Yeniden lex/parse/emit edilen satırlar
+    bool fallback = false;      ///< Satırlar bağımsız çözümlenemedi; tüm dosya çevrildi
+};
+
+/**
+ * @brief Değişmeyen satırların üretilmiş kodunu yeniden kullanan çevirici
+ *
+ * Çıktı, varsayılan seçeneklerle (Dispatch, Map) Codegen::emit_cpp ile
+ * birebir aynıdır. Her satır bir `case` bloğu olur ve blok yalnızca
+ * satırın metnine ve sonraki satırın etiketine bağlıdır; anahtar bu ikisinin
+ * özetidir. Bulunamayan satırlar tek başına lex edilip çözümlenir ve yalnızca
+ * onların blokları üretilir.
+ *
+ * Etiketsiz ya da birden çok satıra yayılan deyimler ile FOR/NEXT (blokları
+ * eşlerine bağlıdır) bağımsız çözümlenemez; böyle bir dosyada tüm kaynak normal yoldan çevrilir (hatalar da oradan gelir).
+ */
+class TranslationCache {
+public:
+    /** @brief Saklanan bir `case` bloğu. */
+    struct Block {
+        std::string text;   ///< Üretilmiş blok
+        int target = -1;    ///< Bloğun atlama hedefi (Codegen::dispatch_target)
+    };
+
+private:
+    std::unordered_map<std::uint64_t, Block> blocks_;  ///< Anahtar -> blok
+    CacheStats stats_;
+
+public:
+    /**
+     * @brief Önbelleği dosyadan yükler
+     * @param path Önbellek dosyası
+     * @return Dosya okunup doğrulandıysa true; aksi halde önbellek boş kalır
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief Önbelleği dosyaya yazar
+     * @param path Önbellek dosyası; önce geçici dosyaya yazılıp yeniden adlandırılır
+     * @return Yazma başarılıysa true
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Kaynağı çevirir, önbelleği son çeviride kullanılan bloklarla günceller
+     * @param source BASIC kaynağı
+     * @return Üretilen C++ kaynak kodu
+     * @throws std::runtime_error Kaynak çözümlenemezse
+     */
+    std::string translate(std::string_view source);
+
+    /** @brief Son translate() çağrısının sayaçları. */
+    const CacheStats& stats() const noexcept { return stats_; }
+    /** @brief Saklanan blok sayısı. */
+    std::size_t size() const noexcept { return blocks_.size(); }
+};
+
+} // namespace translator
@@ -0,0 +1,76 @@
+/**
+ * @file interner.h
+ * @brief Tanımlayıcıları yoğun tamsayı kimliklere eşleyen tekilleştirme tablosu
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "translator/arena.h"
+
+namespace translator {
+
+/// Tekilleştirilmiş tanımlayıcının kimliği (0'dan başlayan yoğun indeks).
+using SymbolId = std::uint32_t;
+
+/**
+ * @brief Her farklı tanımlayıcıya ilk görülme sırasıyla bir kimlik veren tablo
+ * 
+ * Ad metni yalnızca bir kez kopyalanır; sonraki karşılaşmalar aynı kimliği
+ * ve aynı görünümü döndürür. Kimlikler 0..size()-1 aralığında olduğundan
+ * değişken değerleri doğrudan dizilerde tutulabilir.
+ */
+class Interner {
+    std::unique_ptr<Arena> storage_ = std::make_unique<Arena>();  ///< Ad metinlerinin sahibi
+    std::unordered_map<std::string_view, SymbolId> ids_;          ///< Ad -> kimlik
+    std::vector<std::string_view> names_;                         ///< Kimlik -> ad
+
+public:
+    /// Bulunamayan ad için find() dönüş değeri.
+    static constexpr SymbolId npos = static_cast<SymbolId>(-1);
+
+    /**
+     * @brief Adın kimliğini döndürür; ilk kez görülüyorsa ekler
+     * @param name Tanımlayıcı metni
+     * @return Adın kimliği
+     */
+    SymbolId intern(std::string_view name){
+        auto it = ids_.find(name);
+        if (it != ids_.end()) return it->second;
+        SymbolId id = static_cast<SymbolId>(names_.size());
+        std::string_view stored = storage_->copy(name);
+        names_.push_back(stored);
+        ids_.emplace(stored, id);
+        return id;
+    }
+
+    /**
+     * @brief Adı eklemeden arar
+     * @param name Tanımlayıcı metni
+     * @return Kimlik; yoksa npos
+     */
+    SymbolId find(std::string_view name) const {
+        auto it = ids_.find(name);
+        return it == ids_.end() ? npos : it->second;
+    }
+
+    /**
+     * @brief Kimliğin adını döndürür
+     * @param id Geçerli kimlik
+     * @return Tablo yaşadığı sürece geçerli ad görünümü
+     */
+    std::string_view name(SymbolId id) const { return names_[id]; }
+
+    /** @brief Farklı ad sayısı. */
+    std::size_t size() const noexcept { return names_.size(); }
+    /** @brief Kimlik sırasıyla tüm adlar. */
+    const std::vector<std::string_view>& names() const noexcept { return names_; }
+};
+
+} // namespace translator
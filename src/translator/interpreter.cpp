@@ -0,0 +1,140 @@
+/**
+ * @file interpreter.cpp
+ * @brief Ağaç yürütücü yorumlayıcının uygulaması.
+ */
+#include "translator/interpreter.h"
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace translator {
+
+/**
+ * \brief Programı çalıştırmaya hazırlar.
+ * \param p Program
+ */
+Interpreter::Interpreter(const Program& p): prog_(p), index_(current_index(p.index, p.labels)) {}
+
+/**
+ * \brief İfadeyi değerlendirir.
+ * \param e İfade
+ * \return Değer
+ *
+ * Ağaç açık yığınla alt-önce gezilir; derinlik çağrı yığınını tüketmez.
+ */
+double Interpreter::eval(const Expr* e){
+    auto leaf = [&](const Expr* x){
+        if (x->kind() == ExprKind::Number) return static_cast<const NumberExpr*>(x)->value;
+        const double* v = vars_.lookup(static_cast<const VariableExpr*>(x)->id);
+        return v ? *v : 0.0;
+    };
+    if (e->kind() != ExprKind::Binary) return leaf(e);
+    todo_.assign(1, {e, false});
+    values_.clear();
+    while (!todo_.empty()){
+        auto [x, expanded] = todo_.back(); todo_.pop_back();
+        if (x->kind() != ExprKind::Binary){ values_.push_back(leaf(x)); continue; }
+        auto* b = static_cast<const BinaryExpr*>(x);
+        if (!expanded){
+            todo_.push_back({x, true}); todo_.push_back({b->rhs, false}); todo_.push_back({b->lhs, false});
+            continue;
+        }
+        const double r = values_.back(); values_.pop_back();
+        double& l = values_.back();
+        switch (b->op){
+            case '+': l = l + r; break;
+            case '-': l = l - r; break;
+            case '*': l = l * r; break;
+            case '/': l = l / r; break;
+            case '<': l = l < r; break;
+            case '>': l = l > r; break;
+            case '=': l = l == r; break;
+            case 'L': l = l <= r; break;
+            case 'G': l = l >= r; break;
+            case 'N': l = l != r; break;
+            default: throw std::runtime_error(std::string("Interpreter: unsupported operator '") + b->op + "'");
+        }
+    }
+    return values_.back();
+}
+
+/**
+ * \brief Programı çalıştırır.
+ * \param in INPUT kaynağı
+ * \param out PRINT hedefi
+ * \return Çalıştırılan deyim sayısı
+ */
+std::uint64_t Interpreter::run(std::istream& in, std::ostream& out){
+    vars_ = SymbolTable(prog_.symbols);
+    calls_.clear();
+    const std::size_t n = prog_.stmts.size();
+    bounds_.assign(n + 1, {0.0, 0.0});   // n: olmayan etiket
+    std::uint64_t steps = 0;
+    std::size_t pc = 0;
+    // Hedef etiket yoksa n döner; döngü biter.
+    auto target = [&](int label){ int t = index_.find(label); return t != LabelIndex::npos ? static_cast<std::size_t>(t) : n; };
+    while (pc < n){
+        ++steps;
+        const Stmt* st = prog_.stmts[pc];
+        switch (st->kind()){
+            case StmtKind::Let: {
+                auto* s = static_cast<const LetStmt*>(st);
+                vars_.assign(s->id, eval(s->expr));
+                ++pc; break;
+            }
+            case StmtKind::Print:
+                for (const Expr* e : static_cast<const PrintStmt*>(st)->items) out << eval(e);
+                out << '\n';
+                ++pc; break;
+            case StmtKind::Input: {
+                double tmp = 0; in >> tmp;
+                vars_.assign(static_cast<const InputStmt*>(st)->id, tmp);
+                ++pc; break;
+            }
+            case StmtKind::Goto: pc = target(static_cast<const GotoStmt*>(st)->target); break;
+            case StmtKind::IfGoto: {
+                auto* s = static_cast<const IfGotoStmt*>(st);
+                pc = eval(s->cond) ? target(s->target) : pc + 1;
+                break;
+            }
+            case StmtKind::Gosub:
+                // Son deyimdeki GOSUB'un dönüş noktası yoktur; üretilen kod gibi programı bitirir.
+                if (pc + 1 >= n){ pc = n; break; }
+                calls_.push_back(pc + 1);
+                pc = target(static_cast<const GosubStmt*>(st)->target);
+                break;
+            case StmtKind::Return:
+                if (calls_.empty()){ pc = n; break; }
+                pc = calls_.back(); calls_.pop_back();
+                break;
+            case StmtKind::For: {
+                auto* s = static_cast<const ForStmt*>(st);
+                // Döngünün kimliği gövdesinin, yani FOR'dan sonraki deyimin indeksidir.
+                Bounds& b = bounds_[pc + 1];
+                b.limit = eval(s->limit);
+                b.step = s->step ? eval(s->step) : 1.0;
+                const double v = eval(s->start);
+                vars_.assign(s->id, v);
+                // Giriş, NEXT'in sürme koşulunun aynısıdır; sınır NaN ise gövde hiç çalışmaz.
+                pc = (b.step >= 0 ? v <= b.limit : v >= b.limit) ? pc + 1 : target(s->exit);
+                break;
+            }
+            case StmtKind::Next: {
+                auto* s = static_cast<const NextStmt*>(st);
+                const std::size_t body = target(s->body);
+                const Bounds b = bounds_[body];
+                const double* cur = vars_.lookup(s->id);
+                const double v = (cur ? *cur : 0.0) + b.step;
+                vars_.assign(s->id, v);
+                // Giriş, NEXT'in sürme koşulunun aynısıdır; sınır NaN ise gövde hiç çalışmaz.
+                pc = (b.step >= 0 ? v <= b.limit : v >= b.limit) ? body : pc + 1;
+                break;
+            }
+        }
+    }
+    out.flush();
+    return steps;
+}
+
+} // namespace translator
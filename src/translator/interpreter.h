@@ -0,0 +1,72 @@
+/**
+ * @file interpreter.h
+ * @brief Program ağacını doğrudan yürüten başvuru yorumlayıcısı
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <utility>
+#include <vector>
+#include "translator/ast.h"
+#include "translator/label_index.h"
+#include "translator/symbol_table.h"
+
+namespace translator {
+
+/**
+ * @brief AST düğümleri üzerinde çalışan ağaç yürütücü yorumlayıcı
+ *
+ * Hız için değil doğruluk ölçütü olarak yazılmıştır: ifadeler ağaç
+ * üzerinde açık bir yığınla değerlendirilir, değişkenler SymbolTable'da
+ * tutulur. Anlamı
+ * Codegen::emit_cpp çıktısıyla aynıdır: değişkenler 0 ile başlar, olmayan
+ * etikete atlama ve son deyimdeki GOSUB programı bitirir, boş çağrı
+ * yığınında RETURN programı bitirir. FOR sınırı ve adımı girişte bir kez
+ * değerlendirilip gövdenin ilk deyimine bağlı tutulur.
+ */
+class Interpreter {
+public:
+    /**
+     * @brief Programı çalıştırmaya hazırlar
+     * @param p Program; yorumlayıcıdan uzun yaşamalıdır
+     */
+    explicit Interpreter(const Program& p);
+
+    /**
+     * @brief Programı baştan sona çalıştırır
+     * @param in INPUT kaynağı
+     * @param out PRINT hedefi; satırlar `\n` ile biter, çıkışta boşaltılır
+     * @return Çalıştırılan deyim sayısı
+     * @throws std::runtime_error Bilinmeyen bir ikili operatör değerlendirilirse
+     *
+     * Değişkenler her çalıştırmada sıfırlanır.
+     */
+    std::uint64_t run(std::istream& in, std::ostream& out);
+
+    /**
+     * @brief Değişkenin son çalıştırmadan kalan değeri
+     * @param id Değişken kimliği (Program::symbols)
+     * @return Değer; hiç atanmadıysa 0
+     */
+    double value(SymbolId id) const { const double* v = vars_.lookup(id); return v ? *v : 0.0; }
+
+private:
+    double eval(const Expr* e);
+
+    /// Bir FOR döngüsünün girişte hesaplanan sınırı ve adımı.
+    struct Bounds { double limit, step; };
+
+    const Program& prog_;
+    LabelIndex index_;             ///< prog_.labels için doğrulanmış etiket dizini
+    SymbolTable vars_;
+    std::vector<std::size_t> calls_;
+    std::vector<Bounds> bounds_;   ///< Gövdenin ilk deyimi başına döngü sınırları
+    std::vector<std::pair<const Expr*, bool>> todo_;   ///< eval(): (düğüm, işlenenleri hesaplandı mı)
+    std::vector<double> values_;   ///< eval(): hesaplanan işlenenler
+};
+
+} // namespace translator
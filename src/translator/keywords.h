@@ -0,0 +1,134 @@
+/**
+ * @file keywords.h
+ * @brief Derleme zamanında üretilen mükemmel özetlemeli (perfect hash) anahtar sözcük tanıyıcı
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "translator/token.h"
+
+namespace translator {
+
+/**
+ * @brief Anahtar sözcük tablosu girdisi
+ */
+struct Keyword {
+    std::string_view text;  ///< Büyük harfli yazım
+    TokenType type;         ///< Karşılık gelen belirteç türü
+};
+
+/**
+ * @brief Tanınan anahtar sözcükler
+ * 
+ * Yeni bir anahtar sözcük eklemek için bu listeye bir satır eklemek yeterlidir;
+ * özet tablosu derleme zamanında yeniden üretilir.
+ */
+inline constexpr Keyword kKeywords[] = {
+    {"LET", TokenType::KW_LET},     {"PRINT", TokenType::KW_PRINT}, {"INPUT", TokenType::KW_INPUT},
+    {"IF", TokenType::KW_IF},       {"THEN", TokenType::KW_THEN},   {"GOTO", TokenType::KW_GOTO},
+    {"FOR", TokenType::KW_FOR},     {"TO", TokenType::KW_TO},       {"NEXT", TokenType::KW_NEXT},
+    {"GOSUB", TokenType::KW_GOSUB}, {"RETURN", TokenType::KW_RETURN}, {"STEP", TokenType::KW_STEP},
+};
+
+namespace detail {
+
+/** @brief Anahtar sözcük sayısı. */
+inline constexpr std::size_t kKeywordCount = sizeof(kKeywords) / sizeof(kKeywords[0]);
+/** @brief Özet tablosu boyutu (2'nin kuvveti, anahtar sayısının en az 4 katı). */
+inline constexpr std::size_t kKeywordTableSize = 64;
+static_assert(kKeywordTableSize >= 4 * kKeywordCount, "kKeywordTableSize büyütülmeli");
+
+/** @brief ASCII harfini büyük harfe çevirir (yerel ayardan bağımsız). */
+constexpr char ascii_upper(char c) noexcept { return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c; }
+
+/**
+ * @brief Uzunluk, ilk iki ve son karakterden tohumlu özet üretir
+ * @param s En az iki karakterli sözcük
+ * @param seed Tohum değeri
+ * @return Tablo indeksi
+ */
+constexpr std::size_t keyword_hash(std::string_view s, std::uint32_t seed) noexcept {
+    std::uint32_t x = static_cast<std::uint32_t>(s.size());
+    x = x * seed + static_cast<unsigned char>(ascii_upper(s[0]));
+    x = x * seed + static_cast<unsigned char>(ascii_upper(s[1]));
+    x = x * seed + static_cast<unsigned char>(ascii_upper(s[s.size() - 1]));
+    x ^= x >> 13;
+    return x & (kKeywordTableSize - 1);
+}
+
+/** @brief En kısa anahtar sözcük uzunluğu. */
+constexpr std::size_t min_keyword_length() noexcept {
+    std::size_t m = kKeywords[0].text.size();
+    for (const auto& k : kKeywords) if (k.text.size() < m) m = k.text.size();
+    return m;
+}
+
+/** @brief En uzun anahtar sözcük uzunluğu. */
+constexpr std::size_t max_keyword_length() noexcept {
+    std::size_t m = 0;
+    for (const auto& k : kKeywords) if (k.text.size() > m) m = k.text.size();
+    return m;
+}
+
+/**
+ * @brief Tüm anahtar sözcükleri çakışmasız yerleştiren ilk tohumu arar
+ * @return Bulunan tohum; bulunamazsa 0
+ */
+constexpr std::uint32_t find_keyword_seed() noexcept {
+    for (std::uint32_t seed = 3; seed < 4096; seed += 2) {
+        bool used[kKeywordTableSize] = {};
+        bool ok = true;
+        for (const auto& k : kKeywords) {
+            std::size_t h = keyword_hash(k.text, seed);
+            if (used[h]) { ok = false; break; }
+            used[h] = true;
+        }
+        if (ok) return seed;
+    }
+    return 0;
+}
+
+/** @brief Çakışmasız yerleşimi sağlayan tohum. */
+inline constexpr std::uint32_t kKeywordSeed = find_keyword_seed();
+static_assert(kKeywordSeed != 0, "Anahtar sözcükler için mükemmel özet bulunamadı; kKeywordTableSize büyütülmeli");
+static_assert(min_keyword_length() >= 2, "keyword_hash en az iki karakterli anahtar sözcük bekler");
+
+/** @brief Özet yuvası → kKeywords indeksi (boş yuva: -1). */
+struct KeywordTable { signed char slot[kKeywordTableSize]; };
+
+/** @brief Özet tablosunu derleme zamanında kurar. */
+constexpr KeywordTable make_keyword_table() noexcept {
+    KeywordTable t{};
+    for (auto& s : t.slot) s = -1;
+    for (std::size_t i = 0; i < kKeywordCount; ++i) t.slot[keyword_hash(kKeywords[i].text, kKeywordSeed)] = static_cast<signed char>(i);
+    return t;
+}
+
+/** @brief Derleme zamanında kurulan özet tablosu. */
+inline constexpr KeywordTable kKeywordTable = make_keyword_table();
+
+} // namespace detail
+
+/**
+ * @brief Tanımlayıcının anahtar sözcük türünü bulur
+ * @param id Kaynaktaki tanımlayıcı (büyük/küçük harf duyarsız)
+ * @return Anahtar sözcükse ilgili tür, değilse Identifier
+ * 
+ * Tek bir özet hesabı ve en fazla bir yerinde karşılaştırma yapar;
+ * bellek ayırmaz.
+ */
+constexpr TokenType keyword_type(std::string_view id) noexcept {
+    if (id.size() < detail::min_keyword_length() || id.size() > detail::max_keyword_length()) return TokenType::Identifier;
+    int slot = detail::kKeywordTable.slot[detail::keyword_hash(id, detail::kKeywordSeed)];
+    if (slot < 0) return TokenType::Identifier;
+    const Keyword& k = kKeywords[slot];
+    if (k.text.size() != id.size()) return TokenType::Identifier;
+    for (std::size_t i = 0; i < id.size(); ++i) if (detail::ascii_upper(id[i]) != k.text[i]) return TokenType::Identifier;
+    return k.type;
+}
+
+} // namespace translator
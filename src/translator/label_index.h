@@ -0,0 +1,127 @@
+/**
+ * @file label_index.h
+ * @brief Satır etiketinden deyim indeksine sabit zamanlı arama dizini
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace translator {
+
+/**
+ * @brief Etiket → deyim indeksi eşlemesi
+ *
+ * Etiketler sabit bir adımın katları olarak yoğunsa (ör. 10, 20, 30, ...)
+ * `(etiket - taban) / adım` ile doğrudan indekslenen bir dizi kullanılır;
+ * değilse etiketler sıralı tutulur ve ikili arama yapılır. Aynı etiket
+ * birden çok kez geçerse son deyim geçerlidir.
+ */
+class LabelIndex {
+    std::size_t count_ = 0;                       ///< Dizinlenen etiket sayısı
+    bool direct_ = false;                         ///< Doğrudan dizi mi kullanılıyor?
+    std::int64_t base_ = 0;                       ///< En küçük etiket (doğrudan kip)
+    std::int64_t stride_ = 1;                     ///< Etiketler arası ortak adım (doğrudan kip)
+    std::vector<int> table_;                      ///< Yuva başına deyim indeksi ya da npos (doğrudan kip)
+    std::vector<std::pair<int, int>> sorted_;     ///< (etiket, indeks), etikete göre sıralı (seyrek kip)
+
+public:
+    /// Bulunamayan etiket için find() dönüş değeri.
+    static constexpr int npos = -1;
+
+    LabelIndex() = default;
+
+    /**
+     * @brief Etiket dizisinden dizin kurar
+     * @param labels Deyim sırasıyla etiketler
+     *
+     * Doğrudan dizi, yuva sayısı etiket sayısının iki katını (+16)
+     * aşmıyorsa seçilir.
+     */
+    explicit LabelIndex(const std::vector<int>& labels): count_(labels.size()) {
+        if (labels.empty()) return;
+        auto [lo, hi] = std::minmax_element(labels.begin(), labels.end());
+        base_ = *lo;
+        std::int64_t g = 0;
+        for (int l : labels) g = std::gcd(g, static_cast<std::int64_t>(l) - base_);
+        stride_ = g > 0 ? g : 1;
+        const std::int64_t slots = (static_cast<std::int64_t>(*hi) - base_) / stride_ + 1;
+        if (slots <= static_cast<std::int64_t>(labels.size()) * 2 + 16){
+            direct_ = true;
+            table_.assign(static_cast<std::size_t>(slots), npos);
+            for (std::size_t i=0;i<labels.size();++i) table_[static_cast<std::size_t>((labels[i] - base_) / stride_)] = static_cast<int>(i);
+            return;
+        }
+        sorted_.reserve(labels.size());
+        for (std::size_t i=0;i<labels.size();++i) sorted_.emplace_back(labels[i], static_cast<int>(i));
+        std::sort(sorted_.begin(), sorted_.end());
+        // Tekrarlanan etiketlerde en büyük indeks (son deyim) kalır.
+        auto last = std::unique(sorted_.rbegin(), sorted_.rend(), [](const auto& a, const auto& b){ return a.first == b.first; });
+        sorted_.erase(sorted_.begin(), last.base());
+    }
+
+    /**
+     * @brief Etiketin deyim indeksini döndürür
+     * @param label Aranacak etiket
+     * @return Deyim indeksi; etiket yoksa npos
+     */
+    int find(int label) const noexcept {
+        if (direct_){
+            const std::int64_t d = static_cast<std::int64_t>(label) - base_;
+            if (d < 0 || d % stride_ != 0) return npos;
+            const std::int64_t k = d / stride_;
+            return k < static_cast<std::int64_t>(table_.size()) ? table_[static_cast<std::size_t>(k)] : npos;
+        }
+        auto it = std::lower_bound(sorted_.begin(), sorted_.end(), label, [](const auto& e, int l){ return e.first < l; });
+        return it != sorted_.end() && it->first == label ? it->second : npos;
+    }
+
+    /**
+     * @brief Dizin bu etiketlerden kurulmuş gibi mi?
+     * @param labels Deyim sırasıyla etiketler
+     * @return Her etiket kendi deyimine (tekrarlıysa sonuncusuna) çözülüyorsa true
+     *
+     * Elle kurulan ya da düzenlenen programlarda bayat kalan dizini
+     * doğrusal zamanda yakalar.
+     */
+    bool matches(const std::vector<int>& labels) const noexcept {
+        if (count_ != labels.size()) return false;
+        for (std::size_t i=0;i<labels.size();++i){
+            const int t = find(labels[i]);
+            if (t == npos || static_cast<std::size_t>(t) < i || static_cast<std::size_t>(t) >= labels.size()
+                || labels[static_cast<std::size_t>(t)] != labels[i]) return false;
+        }
+        return true;
+    }
+
+    /** @brief Etiket var mı? */
+    bool contains(int label) const noexcept { return find(label) != npos; }
+    /** @brief Dizinlenen etiket sayısı (tekrarlar dahil). */
+    std::size_t size() const noexcept { return count_; }
+    /** @brief Doğrudan dizi kullanılıyor mu? */
+    bool direct() const noexcept { return direct_; }
+
+    friend bool operator==(const LabelIndex& a, const LabelIndex& b){
+        return a.count_ == b.count_ && a.direct_ == b.direct_ && a.base_ == b.base_ && a.stride_ == b.stride_
+            && a.table_ == b.table_ && a.sorted_ == b.sorted_;
+    }
+    friend bool operator!=(const LabelIndex& a, const LabelIndex& b){ return !(a == b); }
+};
+
+/**
+ * @brief Programla birlikte taşınan dizini etiketlere göre doğrular
+ * @param cached Programın dizini
+ * @param labels Programın etiketleri
+ * @return cached etiketlerle uyumluysa onun kopyası, değilse etiketlerden yeni dizin
+ */
+inline LabelIndex current_index(const LabelIndex& cached, const std::vector<int>& labels){
+    return cached.matches(labels) ? cached : LabelIndex(labels);
+}
+
+} // namespace translator
@@ -3,71 +3,157 @@
  * @brief Lexer uygulaması: girdi kaynağını Token listesine dönüştürür.
  */
 #include "translator/lexer.h"
-#include <cctype>
+#include "translator/keywords.h"
+#include "translator/scan.h"
+#include <algorithm>
+#include <string_view>
 
 namespace translator {
 
 /**
- * \brief Bir karakterin tanımlayıcı başlangıcı olup olmadığını kontrol eder.
- * \param c Karakter
- * \return Harf ya da '_' ise true
+ * \brief Girdi kaynağını belirteçlere (Token) dönüştürür.
+ * \return Üretilen Token vektörü (sonunda EOF içerir)
  */
-static bool is_ident_start(char c){ return std::isalpha(static_cast<unsigned char>(c)) || c=='_'; }
+std::vector<Token> Lexer::tokenize() const {
+    auto views = tokenize_view();
+    std::vector<Token> out; out.reserve(views.size());
+    for (const auto& t : views) out.push_back({t.type, std::string(t.lexeme), t.line, t.column});
+    return out;
+}
 
 /**
- * \brief Bir karakterin tanımlayıcı içinde geçerli olup olmadığını kontrol eder.
- * \param c Karakter
- * \return Harf, rakam veya '_' ise true
+ * \brief Sayı literalinin sonunu bulur: `rakamlar[.rakamlar][(e|E)[+|-]rakamlar]`.
+ *
+ * Tamsayı kısmı boş olabilir (`.5`). Üs kısmı ancak ardından en az bir
+ * rakam geliyorsa sayıya dahil edilir; `2E` iki belirteç olarak kalır.
+ * \param p Tampon
+ * \param i Sayının ilk karakteri (rakam ya da '.')
+ * \param n Tampon boyu
+ * \param k Etkin tarama çekirdekleri
+ * \return Sayıdan sonraki ilk konum
  */
-static bool is_ident_char(char c){ return std::isalnum(static_cast<unsigned char>(c)) || c=='_'; }
+static std::size_t scan_number(const char* p, std::size_t i, std::size_t n, const scan::Kernels& k){
+    i = k.skip_digits(p, i, n);
+    if (i<n && p[i]=='.') i = k.skip_digits(p, i+1, n);
+    if (i<n && (p[i]=='e' || p[i]=='E')){
+        std::size_t j = i+1;
+        if (j<n && (p[j]=='+' || p[j]=='-')) ++j;
+        if (j<n && scan::is(p[j], scan::Digit)) i = k.skip_digits(p, j+1, n);
+    }
+    return i;
+}
 
 /**
- * \brief Girdi kaynağını belirteçlere (Token) dönüştürür.
- * \return Üretilen Token vektörü (sonunda EOF içerir)
+ * \brief src içinde i konumundan başlayarak bir sonraki belirteci tarar.
+ *
+ * Boşlukları ve tanınmayan karakterleri atlar. Girdi biterse Eof döndürür.
+ * \param src  Taranan tampon
+ * \param i    Okuma konumu (ilerletilir)
+ * \param line Satır sayacı (ilerletilir)
+ * \param bol  Mevcut satırın başlangıç konumu (ilerletilir); sütun buna göre hesaplanır
+ * \return src'ye işaret eden belirteç
  */
-std::vector<Token> Lexer::tokenize() const {
-    std::vector<Token> out; int line=1; std::size_t i=0, n=src_.size();
-    auto add=[&](TokenType t, const std::string& lx){ out.push_back({t,lx,line}); };
-    while (i<n){ char c = src_[i];
-        if (c=='\r'){ ++i; continue; }
-        if (c=='\n'){ add(TokenType::Newline, "\n"); ++i; ++line; continue; }
-        if (std::isspace(static_cast<unsigned char>(c))){ ++i; continue; }
+static TokenView scan_token(std::string_view src, std::size_t& i, int& line, std::size_t& bol){
+    const std::size_t n = src.size();
+    const char* p = src.data();
+    const scan::Kernels& k = scan::active();
+    auto col=[&](std::size_t at){ return static_cast<int>(at - bol) + 1; };
+    auto one=[&](TokenType t){ ++i; return TokenView{t, src.substr(i-1, 1), line, col(i-1)}; };
+    while (i<n){ char c = p[i];
+        if (scan::is(c, scan::Blank)){ i = k.skip_blanks(p, i+1, n); continue; }
+        if (c=='\n'){ TokenView t = one(TokenType::Newline); ++line; bol = i; return t; }
         if (c=='"'){
-            ++i; std::string s; while(i<n && src_[i] != '"'){ if(src_[i]=='\n') ++line; s.push_back(src_[i++]); }
-            if (i<n && src_[i]=='"') ++i; add(TokenType::String, s); continue;
+            const int l0 = line, c0 = col(i);
+            std::size_t b = ++i; i = k.find_quote(p, i, n, line);
+            std::size_t e = i; if (i<n) ++i;
+            if (line != l0) bol = src.rfind('\n', e) + 1;
+            return {TokenType::String, src.substr(b, e-b), l0, c0};
         }
-        if (std::isdigit(static_cast<unsigned char>(c))){ std::string num; while(i<n && std::isdigit(static_cast<unsigned char>(src_[i]))) num.push_back(src_[i++]); add(TokenType::Number, num); continue; }
-        if (is_ident_start(c)){
-            std::string id; while(i<n && is_ident_char(src_[i])) id.push_back(src_[i++]);
-            std::string up; up.reserve(id.size()); for(char ch:id) up.push_back(std::toupper(static_cast<unsigned char>(ch)));
-            if (up=="LET") add(TokenType::KW_LET, id);
-            else if (up=="PRINT") add(TokenType::KW_PRINT, id);
-            else if (up=="INPUT") add(TokenType::KW_INPUT, id);
-            else if (up=="IF") add(TokenType::KW_IF, id);
-            else if (up=="THEN") add(TokenType::KW_THEN, id);
-            else if (up=="GOTO") add(TokenType::KW_GOTO, id);
-            else if (up=="FOR") add(TokenType::KW_FOR, id);
-            else if (up=="TO") add(TokenType::KW_TO, id);
-            else if (up=="NEXT") add(TokenType::KW_NEXT, id);
-            else if (up=="GOSUB") add(TokenType::KW_GOSUB, id);
-            else if (up=="RETURN") add(TokenType::KW_RETURN, id);
-            else add(TokenType::Identifier, id);
-            continue;
+        if (scan::is(c, scan::Digit) || (c=='.' && i+1<n && scan::is(p[i+1], scan::Digit))){
+            std::size_t b=i; i = scan_number(p, i, n, k);
+            return {TokenType::Number, src.substr(b, i-b), line, col(b)};
+        }
+        if (scan::is(c, scan::IdentStart)){
+            std::size_t b=i; i = k.skip_ident(p, i+1, n);
+            std::string_view id = src.substr(b, i-b);
+            return {keyword_type(id), id, line, col(b)};
         }
         switch(c){
-            case '+': add(TokenType::Plus, "+"); ++i; break;
-            case '-': add(TokenType::Minus, "-"); ++i; break;
-            case '*': add(TokenType::Star, "*"); ++i; break;
-            case '/': add(TokenType::Slash, "/"); ++i; break;
-            case '=': add(TokenType::Assign, "="); ++i; break;
-            case '(': add(TokenType::LParen, "("); ++i; break;
-            case ')': add(TokenType::RParen, ")"); ++i; break;
-            case ',': add(TokenType::Comma, ","); ++i; break;
+            case '+': return one(TokenType::Plus);
+            case '-': return one(TokenType::Minus);
+            case '*': return one(TokenType::Star);
+            case '/': return one(TokenType::Slash);
+            case '=': return one(TokenType::Assign);
+            case '<': case '>': {
+                std::size_t b = i++;
+                TokenType t = c=='<' ? TokenType::Less : TokenType::Greater;
+                if (i<n && p[i]=='='){ t = c=='<' ? TokenType::LessEqual : TokenType::GreaterEqual; ++i; }
+                else if (c=='<' && i<n && p[i]=='>'){ t = TokenType::NotEqual; ++i; }
+                return {t, src.substr(b, i-b), line, col(b)};
+            }
+            case '(': return one(TokenType::LParen);
+            case ')': return one(TokenType::RParen);
+            case ',': return one(TokenType::Comma);
             default: ++i; break;
         }
     }
-    out.push_back({TokenType::Eof, "", line});
+    return {TokenType::Eof, src.substr(n, 0), line, col(n)};
+}
+
+/**
+ * \brief Girdi kaynağını src_ tamponuna işaret eden belirteçlere dönüştürür.
+ * \return Üretilen TokenView vektörü (sonunda EOF içerir)
+ */
+std::vector<TokenView> Lexer::tokenize_view() const {
+    std::vector<TokenView> out; int line=1; std::size_t i=0, bol=0;
+    out.reserve(src_.size()/4+1);
+    for (;;){
+        out.push_back(scan_token(src_, i, line, bol));
+        if (out.back().type == TokenType::Eof) break;
+    }
     return out;
 }
 
+/**
+ * \brief Kaynaktaki bir sonraki belirteci üretir.
+ * \return Üretilen belirteç; girdi bittiğinde Eof
+ */
+TokenView Lexer::next(){ return scan_token(src_, pos_, line_, bol_); }
+
+/** \brief Tampon yenilemelerinden etkilenmeyen satır sonu metni. */
+static constexpr std::string_view kNewline = "\n";
+
+/**
+ * \brief Akıştan bir sonraki mantıksal satırı buf_ içine okur.
+ *
+ * Kapanmamış bir dize literali sonraki satırlara taşıyorsa, tırnaklar
+ * dengelenene kadar satırlar eklenir.
+ * \return Okunacak veri kalmadıysa false
+ */
+bool StreamLexer::refill(){
+    buf_.clear(); pos_ = 0; bol_ = 0;
+    if (!std::getline(in_, buf_)) return false;
+    if (!in_.eof()) buf_.push_back('\n');
+    while (!in_.eof() && std::count(buf_.begin(), buf_.end(), '"') % 2 != 0){
+        std::string more;
+        if (!std::getline(in_, more)) break;
+        buf_ += more;
+        if (!in_.eof()) buf_.push_back('\n');
+    }
+    return true;
+}
+
+/**
+ * \brief Akıştaki bir sonraki belirteci üretir.
+ * \return Üretilen belirteç; girdi bittiğinde her çağrıda Eof
+ */
+TokenView StreamLexer::next(){
+    for (;;){
+        TokenView t = scan_token(buf_, pos_, line_, bol_);
+        if (t.type == TokenType::Newline) return {TokenType::Newline, kNewline, t.line, t.column};
+        if (t.type != TokenType::Eof) return t;
+        if (!refill()) return {TokenType::Eof, std::string_view(), line_, t.column};
+    }
+}
+
 } // namespace translator
@@ -3,21 +3,82 @@
  * @brief BASIC benzeri dil için leksik analizci arabirimi.
  */
 #pragma once
+#include <istream>
 #include <string>
 #include <vector>
+#include <string_view>
+#include "translator/source.h"
 #include "translator/token.h"
 
 namespace translator {
 
 /** @brief Kaynaktan belirteç (Token) üreten sınıf. */
 class Lexer {
-    /** Kaynak metin (tam içerik). */
-    const std::string src_;
+    /** Sahiplenilen kaynak metin (string kurucusu için). */
+    const std::string owned_;
+    /** Taranan kaynak (owned_ ya da dışarıdaki bir SourceBuffer). */
+    const std::string_view src_;
+    /** next() için okuma konumu. */
+    std::size_t pos_ = 0;
+    /** next() için satır sayacı. */
+    int line_ = 1;
+    /** next() için mevcut satırın başlangıç konumu. */
+    std::size_t bol_ = 0;
 public:
     /** @brief Kaynağı alarak bir lexer oluşturur. */
-    explicit Lexer(std::string src): src_(std::move(src)) {}
+    explicit Lexer(std::string src): owned_(std::move(src)), src_(owned_) {}
+    /**
+     * @brief Bir kaynak tamponunu kopyalamadan tarayan lexer oluşturur.
+     * @param src Kaynak; lexer ve ürettiği belirteçler kullanıldığı sürece
+     *            yaşamalı ve taşınmamalıdır
+     */
+    explicit Lexer(const SourceBuffer& src): src_(src.view()) {}
+    /// src_ owned_'a işaret edebildiğinden kopyalanamaz.
+    Lexer(const Lexer&) = delete;
+    Lexer& operator=(const Lexer&) = delete;
+
     /** @brief Girdi kaynağını belirteçlere dönüştürür. */
     std::vector<Token> tokenize() const;
+    /**
+     * @brief Girdi kaynağını kopyasız belirteçlere dönüştürür.
+     *
+     * Üretilen görünümler src_ tamponuna işaret eder; Lexer nesnesi
+     * yaşadığı sürece geçerlidir.
+     */
+    std::vector<TokenView> tokenize_view() const;
+    /**
+     * @brief Bir sonraki belirteci üretir (çekme tabanlı kullanım).
+     *
+     * Belirteç listesi oluşturmadan kaynağı baştan sona bir kez tarar;
+     * girdi bittiğinde her çağrıda Eof döndürür.
+     */
+    TokenView next();
+};
+
+/**
+ * @brief std::istream üzerinden satır satır okuyan, çekme (pull) tabanlı lexer.
+ *
+ * Bellekte yalnızca o an taranan mantıksal satır tutulur; bu nedenle girdi
+ * boyutundan bağımsız, en uzun satırla sınırlı bellek kullanır. Belirteçler
+ * Lexer ile aynı kurallarla üretilir.
+ *
+ * next() ile dönen görünümler, yeni bir satır okununcaya kadar geçerlidir.
+ * Satır yenilemesi yalnızca bir Newline belirtecinden sonra olur; Newline ve
+ * Eof belirteçlerinin metni sabit olduğundan her zaman geçerlidir.
+ */
+class StreamLexer {
+    std::istream& in_;      ///< Girdi akışı
+    std::string buf_;       ///< Taranan mantıksal satır
+    std::size_t pos_ = 0;   ///< buf_ içindeki okuma konumu
+    int line_ = 1;          ///< Satır sayacı
+    std::size_t bol_ = 0;   ///< buf_ içinde mevcut satırın başlangıcı
+
+    bool refill();
+public:
+    /** @brief Akışı okuyacak bir lexer oluşturur (akış, lexer'dan uzun yaşamalıdır). */
+    explicit StreamLexer(std::istream& in): in_(in) {}
+    /** @brief Bir sonraki belirteci döndürür; girdi bittiğinde Eof. */
+    TokenView next();
 };
 
 } // namespace translator
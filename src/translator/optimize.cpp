@@ -0,0 +1,402 @@
+/**
+ * @file optimize.cpp
+ * @brief Sabit katlama, cebirsel sadeleştirme ve blok içi sabit yayılımı.
+ */
+#include "translator/optimize.h"
+#include "translator/cfg.h"
+#include "translator/structure.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace translator {
+
+namespace {
+
+/**
+ * \brief Eski ifade dizilerini okuyup sadeleştirilmiş yenilerini kurar.
+ *
+ * Sabit ortamı değişken kimliği başına bir değer ve bir nesil damgası
+ * tutar; nesil artırılarak blok başında ortam O(1)'de temizlenir.
+ */
+class Simplifier {
+    const FlatProgram& in_;
+    FlatProgram& out_;
+    OptimizeStats& stats_;
+    std::vector<double> value_;          ///< Kimlik başına bilinen sabit
+    std::vector<std::uint32_t> stamp_;   ///< Değer hangi nesilde yazıldı
+    std::uint32_t gen_ = 1;              ///< Geçerli blok nesli
+
+    NodeIndex push(ExprKind k, char op, NodeIndex a, NodeIndex b){
+        NodeIndex idx = static_cast<NodeIndex>(out_.expr_kind.size());
+        out_.expr_kind.push_back(k); out_.expr_op.push_back(op);
+        out_.expr_a.push_back(a); out_.expr_b.push_back(b);
+        return idx;
+    }
+
+    NodeIndex number(double v){
+        NodeIndex n = static_cast<NodeIndex>(out_.numbers.size());
+        out_.numbers.push_back(v);
+        return push(ExprKind::Number, 0, n, -1);
+    }
+
+    /** \brief Yeni dizileri verilen boyutlara geri kırpar. */
+    void rewind(std::size_t nodes, std::size_t nums){
+        out_.expr_kind.resize(nodes); out_.expr_op.resize(nodes); out_.expr_a.resize(nodes); out_.expr_b.resize(nodes);
+        out_.numbers.resize(nums);
+    }
+
+    bool is_number(NodeIndex e) const { return out_.expr_kind[e] == ExprKind::Number; }
+    bool is_number(NodeIndex e, double v) const { return is_number(e) && out_.numbers[out_.expr_a[e]] == v; }
+    double value_of(NodeIndex e) const { return out_.numbers[out_.expr_a[e]]; }
+
+    /** \brief Sabitleri katlar; sonuç sonlu değilse false döndürür. */
+    static bool fold(char op, double l, double r, double& out){
+        switch (op){
+            case '+': out = l + r; break;
+            case '-': out = l - r; break;
+            case '*': out = l * r; break;
+            case '/': out = l / r; break;
+            case '<': out = l < r; break;
+            case '>': out = l > r; break;
+            case '=': out = l == r; break;
+            case 'L': out = l <= r; break;
+            case 'G': out = l >= r; break;
+            case 'N': out = l != r; break;
+            default: return false;
+        }
+        return std::isfinite(out);
+    }
+
+public:
+    Simplifier(const FlatProgram& in, FlatProgram& out, OptimizeStats& stats)
+        : in_(in), out_(out), stats_(stats), value_(in.names.size(), 0.0), stamp_(in.names.size(), 0) {}
+
+    /// Yeni temel blok: bilinen tüm sabitleri unutur.
+    void new_block(){ ++gen_; }
+    /// Değişkenin sabit değerini kaydeder.
+    void bind(NodeIndex id, double v){ value_[id] = v; stamp_[id] = gen_; }
+    /// Değişken hakkındaki bilgiyi siler.
+    void forget(NodeIndex id){ stamp_[id] = 0; }
+    /// Değişken düğümünü sabit yayılımı yapmadan yazar (FOR'un döngü değişkeni).
+    NodeIndex variable(NodeIndex id){ return push(ExprKind::Variable, 0, id, -1); }
+
+    /**
+     * \brief Eski e düğümünü sadeleştirip yeni dizilere yazar.
+     * \param e Eski ifade indeksi
+     * \return Yeni ifade indeksi
+     *
+     * Açık yığınla alt-önce gezilir; derinlik çağrı yığınını tüketmez.
+     */
+    NodeIndex simplify(NodeIndex e){
+        if (in_.expr_kind[e] != ExprKind::Binary) return leaf(e);
+        todo_.assign(1, {e, false, 0, 0});
+        done_.clear();
+        while (!todo_.empty()){
+            const Frame f = todo_.back(); todo_.pop_back();
+            if (in_.expr_kind[f.e] != ExprKind::Binary){ done_.push_back(leaf(f.e)); continue; }
+            if (!f.expanded){
+                // Düğümün yazdıkları dizilerin bu noktasından başlar; katlanırsa buraya geri sarılır.
+                todo_.push_back({f.e, true, out_.expr_kind.size(), out_.numbers.size()});
+                todo_.push_back({in_.expr_b[f.e], false, 0, 0});
+                todo_.push_back({in_.expr_a[f.e], false, 0, 0});
+                continue;
+            }
+            const NodeIndex r = done_.back(); done_.pop_back();
+            const NodeIndex l = done_.back();
+            done_.back() = combine(in_.expr_op[f.e], l, r, f.mark, f.nmark);
+        }
+        return done_.back();
+    }
+
+private:
+    /// simplify() yığın çerçevesi: eski düğüm, işlenenleri yazıldı mı, yazmaya başladığı konumlar.
+    struct Frame { NodeIndex e; bool expanded; std::size_t mark, nmark; };
+    std::vector<Frame> todo_;
+    std::vector<NodeIndex> done_;   ///< Sadeleştirilmiş işlenenlerin yeni indeksleri
+
+    /** \brief Sabit ya da değişken düğümünü yazar; bilinen değişken sabite döner. */
+    NodeIndex leaf(NodeIndex e){
+        if (in_.expr_kind[e] == ExprKind::Number) return number(in_.numbers[in_.expr_a[e]]);
+        NodeIndex id = in_.expr_a[e];
+        if (stamp_[id] == gen_){ ++stats_.propagated; return number(value_[id]); }
+        return push(ExprKind::Variable, 0, id, -1);
+    }
+
+    /** \brief Sadeleştirilmiş işlenenlerden ikili düğümü kurar: katlar, özdeşliği düşürür ya da yazar. */
+    NodeIndex combine(char op, NodeIndex l, NodeIndex r, std::size_t mark, std::size_t nmark){
+        double v;
+        if (is_number(l) && is_number(r) && fold(op, value_of(l), value_of(r), v)){
+            // Bu düğüm için yazılan her şey dizilerin sonundadır; geri alınıp tek sabit yazılır.
+            rewind(mark, nmark);
+            ++stats_.folded;
+            return number(v);
+        }
+        NodeIndex keep = -1;
+        switch (op){
+            case '-': keep = is_number(r, 0) ? l : -1; break;
+            case '*': keep = is_number(r, 1) ? l : is_number(l, 1) ? r : -1; break;
+            case '/': keep = is_number(r, 1) ? l : -1; break;
+            default: break;
+        }
+        if (keep >= 0){ ++stats_.simplified; return keep; }
+        return push(ExprKind::Binary, op, l, r);
+    }
+};
+
+/**
+ * \brief Yalnızca deyimlerden erişilebilen düğümleri alt-önce sırada kopyalar.
+ *
+ * Özdeşlik kuralları bir işleneni bıraktığında diğer işlenen dizide
+ * sahipsiz kalır; bu adım onları atar.
+ */
+class Compactor {
+    const FlatProgram& in_;
+    FlatProgram& out_;
+public:
+    Compactor(const FlatProgram& in, FlatProgram& out): in_(in), out_(out) {}
+
+    /** \brief e'nin alt ağacını kopyalar; açık yığınla, işlenenler ebeveynden önce yazılır. */
+    NodeIndex copy(NodeIndex e){
+        todo_.assign(1, {e, false});
+        done_.clear();
+        while (!todo_.empty()){
+            auto [x, expanded] = todo_.back(); todo_.pop_back();
+            NodeIndex a = in_.expr_a[x], b = in_.expr_b[x];
+            switch (in_.expr_kind[x]){
+                case ExprKind::Number: a = static_cast<NodeIndex>(out_.numbers.size()); out_.numbers.push_back(in_.numbers[in_.expr_a[x]]); break;
+                case ExprKind::Variable: break;
+                case ExprKind::Binary:
+                    if (!expanded){ todo_.push_back({x, true}); todo_.push_back({b, false}); todo_.push_back({a, false}); continue; }
+                    b = done_.back(); done_.pop_back();
+                    a = done_.back(); done_.pop_back();
+                    break;
+            }
+            done_.push_back(static_cast<NodeIndex>(out_.expr_kind.size()));
+            out_.expr_kind.push_back(in_.expr_kind[x]); out_.expr_op.push_back(in_.expr_op[x]);
+            out_.expr_a.push_back(a); out_.expr_b.push_back(b);
+        }
+        return done_.back();
+    }
+
+private:
+    std::vector<std::pair<NodeIndex, bool>> todo_;   ///< (eski düğüm, işlenenleri kopyalandı mı)
+    std::vector<NodeIndex> done_;                    ///< Kopyalanan işlenenlerin yeni indeksleri
+};
+
+/**
+ * \brief p'nin deyimlerinin src'de duran ifadelerini ve PRINT / FOR öğelerini p'ye taşır.
+ * \param p Deyimleri src dizilerini gösteren program; ifade dizileri ve öğeler değiştirilir
+ * \param src İfade ve öğe dizilerinin bulunduğu program
+ */
+void repack(FlatProgram& p, const FlatProgram& src){
+    FlatProgram packed;
+    packed.items.reserve(src.items.size());
+    Compactor c(src, packed);
+    for (std::size_t i=0;i<p.size();++i){
+        switch (p.stmt_kind[i]){
+            case StmtKind::Let: case StmtKind::IfGoto: p.stmt_b[i] = c.copy(p.stmt_b[i]); break;
+            case StmtKind::Print: {
+                NodeIndex first = static_cast<NodeIndex>(packed.items.size());
+                for (NodeIndex j=0;j<p.stmt_b[i];++j) packed.items.push_back(c.copy(src.items[p.stmt_a[i] + j]));
+                p.stmt_a[i] = first;
+                break;
+            }
+            case StmtKind::For: {
+                NodeIndex first = static_cast<NodeIndex>(packed.items.size());
+                for (NodeIndex j=0;j<4;++j) packed.items.push_back(c.copy(src.items[p.stmt_b[i] + j]));
+                p.stmt_b[i] = first;
+                break;
+            }
+            default: break;
+        }
+    }
+    p.expr_kind = std::move(packed.expr_kind); p.expr_op = std::move(packed.expr_op);
+    p.expr_a = std::move(packed.expr_a); p.expr_b = std::move(packed.expr_b);
+    p.numbers = std::move(packed.numbers); p.items = std::move(packed.items);
+}
+
+/// İfadenin okuduğu değişkenleri ekler; todo çağrılar arasında yeniden kullanılan açık yığındır.
+void collect_uses(const FlatProgram& p, NodeIndex e, std::vector<NodeIndex>& out, std::vector<NodeIndex>& todo){
+    todo.assign(1, e);
+    while (!todo.empty()){
+        const NodeIndex x = todo.back(); todo.pop_back();
+        switch (p.expr_kind[x]){
+            case ExprKind::Number: break;
+            case ExprKind::Variable: out.push_back(p.expr_a[x]); break;
+            case ExprKind::Binary: todo.push_back(p.expr_b[x]); todo.push_back(p.expr_a[x]); break;
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * \brief İfadeleri sadeleştirir ve sabitleri temel blok içinde yayar.
+ * \param p Düz program
+ * \return Geçiş sayaçları
+ */
+OptimizeStats optimize(FlatProgram& p){
+    OptimizeStats stats;
+    stats.nodes_before = p.expr_kind.size();
+    const Structure blocks = find_basic_blocks(p, build_cfg(p));
+
+    FlatProgram out;
+    out.expr_kind.reserve(p.expr_kind.size()); out.expr_op.reserve(p.expr_kind.size());
+    out.expr_a.reserve(p.expr_kind.size()); out.expr_b.reserve(p.expr_kind.size());
+    out.numbers.reserve(p.numbers.size());
+    out.items.reserve(p.items.size());
+    Simplifier s(p, out, stats);
+
+    std::size_t next_leader = 0;
+    for (std::size_t i=0;i<p.size();++i){
+        if (next_leader < blocks.leaders.size() && blocks.leaders[next_leader] == static_cast<int>(i)){ s.new_block(); ++next_leader; }
+        const NodeIndex a = p.stmt_a[i], b = p.stmt_b[i];
+        switch (p.stmt_kind[i]){
+            case StmtKind::Let: {
+                NodeIndex e = s.simplify(b);
+                p.stmt_b[i] = e;
+                if (out.expr_kind[e] == ExprKind::Number) s.bind(a, out.numbers[out.expr_a[e]]); else s.forget(a);
+                break;
+            }
+            case StmtKind::Print: {
+                NodeIndex first = static_cast<NodeIndex>(out.items.size());
+                for (NodeIndex k=0;k<b;++k) out.items.push_back(s.simplify(p.items[a + k]));
+                p.stmt_a[i] = first;
+                break;
+            }
+            case StmtKind::Input: s.forget(a); break;
+            case StmtKind::IfGoto: p.stmt_b[i] = s.simplify(b); break;
+            case StmtKind::For: {
+                NodeIndex first = static_cast<NodeIndex>(out.items.size());
+                out.items.push_back(s.variable(p.expr_a[p.items[b]]));
+                for (NodeIndex k=1;k<4;++k) out.items.push_back(s.simplify(p.items[b + k]));
+                p.stmt_b[i] = first;
+                s.forget(p.expr_a[p.items[b]]);
+                break;
+            }
+            case StmtKind::Next: s.forget(b); break;
+            default: break;
+        }
+    }
+    // Sahipsiz düğümleri atarak ifade dizilerini yeniden kur.
+    repack(p, out);
+    stats.nodes_after = p.expr_kind.size();
+    return stats;
+}
+
+/**
+ * \brief Erişilemeyen deyimleri ve okunmayan LET'leri siler.
+ * \param p Düz program
+ * \return Silinen deyim sayaçları
+ *
+ * Canlılık, değişken başına bir bitlik kümelerle geriye doğru iş listesi
+ * üzerinden hesaplanır. Güçlü canlılık kullanılır: hedefi ölü bir LET'in
+ * ifadesi hiçbir değişkeni canlı tutmaz; böylece ölü atama zincirleri tek
+ * geçişte düşer.
+ */
+DeadCodeStats eliminate_dead_code(FlatProgram& p){
+    DeadCodeStats stats;
+    const int n = static_cast<int>(p.size());
+    stats.stmts_before = p.size();
+    if (n == 0) return stats;
+    const CFG cfg = build_cfg(p);
+    const std::vector<int> dist = cfg.g.bfs_dist(0);
+
+    // Ardıllar: CFG kenarları, RETURN için ise her GOSUB'un dönüş noktası.
+    std::vector<int> return_sites;
+    for (int i=0;i+1<n;++i) if (p.stmt_kind[i] == StmtKind::Gosub) return_sites.push_back(i + 1);
+    auto successors = [&](int i) -> const std::vector<int>& {
+        return p.stmt_kind[i] == StmtKind::Return ? return_sites : cfg.g.neighbors(i);
+    };
+    std::vector<std::vector<int>> preds(n);
+    for (int i=0;i<n;++i) if (dist[i] >= 0) for (int s : successors(i)) preds[s].push_back(i);
+
+    // Deyim başına okunan değişkenler (LET için ifadenin okudukları).
+    std::vector<std::size_t> use_at(n + 1, 0);
+    std::vector<NodeIndex> uses, todo;
+    for (int i=0;i<n;++i){
+        use_at[i] = uses.size();
+        switch (p.stmt_kind[i]){
+            case StmtKind::Let: case StmtKind::IfGoto: collect_uses(p, p.stmt_b[i], uses, todo); break;
+            case StmtKind::Print: for (NodeIndex k=0;k<p.stmt_b[i];++k) collect_uses(p, p.items[p.stmt_a[i] + k], uses, todo); break;
+            case StmtKind::For: for (NodeIndex k=1;k<4;++k) collect_uses(p, p.items[p.stmt_b[i] + k], uses, todo); break;
+            case StmtKind::Next: uses.push_back(p.stmt_b[i]); break;
+            default: break;
+        }
+    }
+    use_at[n] = uses.size();
+    // Deyim başına yazılan değişken (yoksa -1); NEXT okuyup yazdığından öldürmez.
+    auto def_of = [&](int i) -> NodeIndex {
+        switch (p.stmt_kind[i]){
+            case StmtKind::Let: case StmtKind::Input: return p.stmt_a[i];
+            case StmtKind::For: return p.expr_a[p.items[p.stmt_b[i]]];
+            default: return -1;
+        }
+    };
+
+    const std::size_t words = (p.names.size() + 63) / 64;
+    std::vector<std::uint64_t> live_out(static_cast<std::size_t>(n) * words, 0), in(words);
+    auto bit = [](const std::uint64_t* set, NodeIndex v){ return (set[v / 64] >> (v % 64)) & 1u; };
+    std::vector<int> work;
+    std::vector<unsigned char> queued(n, 0);
+    for (int i=0;i<n;++i) if (dist[i] >= 0){ work.push_back(i); queued[i] = 1; }
+    while (!work.empty()){
+        const int i = work.back(); work.pop_back(); queued[i] = 0;
+        const std::uint64_t* out = &live_out[static_cast<std::size_t>(i) * words];
+        std::copy(out, out + words, in.begin());
+        const StmtKind k = p.stmt_kind[i];
+        const bool gen = k != StmtKind::Let || bit(out, p.stmt_a[i]);
+        const NodeIndex def = def_of(i);
+        if (def >= 0) in[def / 64] &= ~(std::uint64_t{1} << (def % 64));
+        if (gen) for (std::size_t u=use_at[i];u<use_at[i + 1];++u) in[uses[u] / 64] |= std::uint64_t{1} << (uses[u] % 64);
+        for (int q : preds[i]){
+            std::uint64_t* qo = &live_out[static_cast<std::size_t>(q) * words];
+            bool changed = false;
+            for (std::size_t w=0;w<words;++w){ std::uint64_t v = qo[w] | in[w]; changed |= v != qo[w]; qo[w] = v; }
+            if (changed && !queued[q]){ work.push_back(q); queued[q] = 1; }
+        }
+    }
+
+    std::vector<unsigned char> keep(n, 1);
+    for (int i=0;i<n;++i){
+        if (dist[i] < 0){ keep[i] = 0; ++stats.unreachable; }
+        else if (p.stmt_kind[i] == StmtKind::Let && !bit(&live_out[static_cast<std::size_t>(i) * words], p.stmt_a[i])){ keep[i] = 0; ++stats.dead_stores; }
+    }
+    // Ardından hiçbir deyim kalmayan GOSUB son deyim olur ve programı bitirirdi;
+    // dönüş noktası olan ölü LET bu durumda korunur.
+    for (int i=n-1, kept_after=0;i>=0;--i){
+        if (keep[i] && p.stmt_kind[i] == StmtKind::Gosub && !kept_after && i + 1 < n){ keep[i + 1] = 1; --stats.dead_stores; }
+        kept_after |= keep[i];
+    }
+    if (stats.removed() == 0) return stats;
+
+    // Silinen bir deyime atlayanlar, ondan sonraki ilk kalan deyime yönlenir;
+    // kalan yoksa programı bitiren var olmayan bir etikete (-1).
+    std::vector<int> next_kept(n + 1, -1);
+    for (int i=n-1;i>=0;--i) next_kept[i] = keep[i] ? p.labels[i] : next_kept[i + 1];
+    int w = 0;
+    for (int i=0;i<n;++i){
+        if (!keep[i]) continue;
+        const StmtKind k = p.stmt_kind[i];
+        if (k == StmtKind::Goto || k == StmtKind::IfGoto || k == StmtKind::Gosub || k == StmtKind::For || k == StmtKind::Next){
+            int t = cfg.label_to_index.find(p.stmt_a[i]);
+            if (t != LabelIndex::npos && !keep[t]) p.stmt_a[i] = next_kept[t];
+        }
+        p.labels[w] = p.labels[i]; p.stmt_kind[w] = k; p.stmt_a[w] = p.stmt_a[i]; p.stmt_b[w] = p.stmt_b[i];
+        ++w;
+    }
+    p.labels.resize(w); p.stmt_kind.resize(w); p.stmt_a.resize(w); p.stmt_b.resize(w);
+    p.index = LabelIndex(p.labels);
+
+    FlatProgram src;
+    src.expr_kind = std::move(p.expr_kind); src.expr_op = std::move(p.expr_op);
+    src.expr_a = std::move(p.expr_a); src.expr_b = std::move(p.expr_b);
+    src.numbers = std::move(p.numbers); src.items = std::move(p.items);
+    repack(p, src);
+    return stats;
+}
+
+} // namespace translator
@@ -0,0 +1,76 @@
+/**
+ * @file optimize.h
+ * @brief Düz AST üzerinde sabit katlama, sadeleştirme ve ölü kod eleme geçişleri
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include "translator/flat_ast.h"
+
+namespace translator {
+
+/**
+ * @brief Eniyileme geçişinin sayaçları
+ */
+struct OptimizeStats {
+    std::size_t nodes_before = 0;   ///< Geçişten önceki ifade düğümü sayısı
+    std::size_t nodes_after = 0;    ///< Geçişten sonraki ifade düğümü sayısı
+    std::size_t folded = 0;         ///< Sabite indirgenen ikili işlemler
+    std::size_t simplified = 0;     ///< Özdeşlikle kaldırılan işlemler (x*1, x-0, ...)
+    std::size_t propagated = 0;     ///< Sabit değeriyle değiştirilen değişken okumaları
+
+    /** @brief Elenen ifade düğümü sayısı. */
+    std::size_t eliminated() const noexcept { return nodes_before > nodes_after ? nodes_before - nodes_after : 0; }
+};
+
+/**
+ * @brief İfadeleri sadeleştirir ve sabitleri temel blok içinde yayar
+ * @param p Yerinde değiştirilecek düz program
+ * @return Geçiş sayaçları
+ *
+ * - İki sabit işlenenli işlemler katlanır (sonuç sonlu değilse katlanmaz).
+ * - `x-0`, `x*1`, `1*x`, `x/1` → `x`. Bu kurallar inf, NaN ve -0 için de
+ *   aynı sonucu verir; vermeyenler (`x+0` -0'ı 0 yapar, `x-x` NaN'ı 0
+ *   yapar) uygulanmaz, böylece eniyileme program çıktısını değiştirmez.
+ * - Bir temel blok içinde sabit atanan değişkenin sonraki okumaları o
+ *   sabitle değiştirilir; INPUT ya da sabit olmayan atama bilgiyi siler.
+ *
+ * İfade dizileri, yalnızca erişilebilir düğümleri alt-önce sırada
+ * içerecek biçimde yeniden kurulur. Deyimler ve etiketler değişmez.
+ */
+OptimizeStats optimize(FlatProgram& p);
+
+/**
+ * @brief Ölü kod eleme geçişinin sayaçları
+ */
+struct DeadCodeStats {
+    std::size_t stmts_before = 0;   ///< Geçişten önceki deyim sayısı
+    std::size_t unreachable = 0;    ///< Giriş etiketinden erişilemeyen deyimler
+    std::size_t dead_stores = 0;    ///< Değeri hiç okunmayan LET'ler
+
+    /** @brief Silinen deyim sayısı. */
+    std::size_t removed() const noexcept { return unreachable + dead_stores; }
+};
+
+/**
+ * @brief Erişilemeyen deyimleri ve ölü atamaları siler
+ * @param p Yerinde değiştirilecek düz program
+ * @return Geçiş sayaçları
+ *
+ * - İlk deyimden CFG üzerinde erişilemeyen deyimler (koşulsuz GOTO
+ *   sonrası, hiç çağrılmayan GOSUB gövdeleri) silinir.
+ * - Hedef değişkeni sonraki hiçbir yolda okunmadan yeniden yazılan ya da
+ *   hiç okunmayan LET'ler silinir. RETURN'ün ardılları tüm GOSUB dönüş
+ *   noktaları kabul edilir. INPUT okuduğu için silinmez. Ardında başka
+ *   deyim kalmayacak bir GOSUB'un dönüş noktası silinmez.
+ *
+ * Silinen bir deyime atlayan GOTO/IF/GOSUB, ondan sonraki ilk kalan
+ * deyimin etiketine yönlendirilir; kalan yoksa hedef var olmayan -1
+ * etiketi olur ve atlama programı bitirir. İfade dizileri optimize()
+ * gibi yeniden kurulur.
+ */
+DeadCodeStats eliminate_dead_code(FlatProgram& p);
+
+} // namespace translator
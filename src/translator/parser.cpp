@@ -3,77 +3,160 @@
  * @brief Parser uygulaması: Token dizisinden AST üretir.
  */
 #include "translator/parser.h"
+#include <algorithm>
+#include <charconv>
 #include <stdexcept>
+#include <string>
 
 namespace translator {
 
 /**
- * \brief Toplama/çıkarma operatörü mü?
+ * \brief İkili operatör belirtecini AST operatörüne çevirir.
  * \param t Token türü
- * \return Plus veya Minus ise true
+ * \return BinaryExpr::op karakteri; ikili operatör değilse 0
  */
-static bool is_add_op(TokenType t){ return t==TokenType::Plus || t==TokenType::Minus; }
+static char binary_op(TokenType t){
+    switch (t){
+        case TokenType::Plus: return '+';
+        case TokenType::Minus: return '-';
+        case TokenType::Star: return '*';
+        case TokenType::Slash: return '/';
+        case TokenType::Less: return '<';
+        case TokenType::Greater: return '>';
+        case TokenType::Assign: return '=';
+        case TokenType::LessEqual: return 'L';
+        case TokenType::GreaterEqual: return 'G';
+        case TokenType::NotEqual: return 'N';
+        default: return 0;
+    }
+}
 
 /**
- * \brief Çarpma/bölme operatörü mü?
- * \param t Token türü
- * \return Star veya Slash ise true
+ * \brief Operatör yığınındaki bir girdinin önceliği.
+ * \param op BinaryExpr::op karakteri, tekli eksi için 'u', açık parantez için '('
+ * \return Büyük olan daha sıkı bağlanır; parantez hiçbir operatörle indirgenmez
+ */
+static int precedence(char op){
+    switch (op){
+        case '(': return 0;
+        case '+': case '-': return 2;
+        case '*': case '/': return 3;
+        case 'u': return 4;
+        default: return 1;  // karşılaştırmalar
+    }
+}
+
+/**
+ * \brief Sayı belirtecini kaynaktan doğrudan çevirir.
+ * \param t Number belirteci
+ * \param[out] v Değer
+ * \return Değer double aralığına sığıyorsa true
+ *
+ * std::from_chars yerel ayardan bağımsızdır, sonlandırıcı gerektirmez ve
+ * bellek ayırmaz; std::stod'un aksine lexeme kopyalanmaz.
  */
-static bool is_mul_op(TokenType t){ return t==TokenType::Star || t==TokenType::Slash; }
+static bool parse_number(const TokenView& t, double& v){
+    auto r = std::from_chars(t.lexeme.data(), t.lexeme.data() + t.lexeme.size(), v);
+    return r.ec == std::errc() && r.ptr == t.lexeme.data() + t.lexeme.size();
+}
 
 /**
- * \brief Toplama/çıkarma önceliğiyle bir ifadeyi çözümler.
- * \return Çözümlenen ifade düğümü
+ * \brief Satır numarası belirtecini çevirir.
+ * \param t Belirteç
+ * \param[out] v Satır numarası
+ * \return Belirteç int'e sığan bir tamsayıysa true
  */
-std::unique_ptr<Expr> Parser::parse_expression() const {
-    auto left = parse_term();
-    while (is_add_op(peek().type)) {
-        char op = (peek().type==TokenType::Plus)?'+':'-'; advance();
-        auto right = parse_term();
-        left = std::make_unique<BinaryExpr>(op, std::move(left), std::move(right));
-    }
-    return left;
+static bool parse_line_number(const TokenView& t, int& v){
+    if (t.type != TokenType::Number) return false;
+    auto r = std::from_chars(t.lexeme.data(), t.lexeme.data() + t.lexeme.size(), v);
+    return r.ec == std::errc() && r.ptr == t.lexeme.data() + t.lexeme.size();
 }
 
 /**
- * \brief Çarpma/bölme önceliğiyle bir terimi çözümler.
- * \return Çözümlenen terim düğümü
+ * \brief Sahiplenilen token dizisini alır ve üzerine görünümler kurar.
+ * \param toks Çözümlenecek token dizisi
  */
-std::unique_ptr<Expr> Parser::parse_term() const {
-    auto left = parse_factor();
-    while (is_mul_op(peek().type)) {
-        char op = (peek().type==TokenType::Star)?'*':'/'; advance();
-        auto right = parse_factor();
-        left = std::make_unique<BinaryExpr>(op, std::move(left), std::move(right));
-    }
-    return left;
+Parser::Parser(std::vector<Token> toks): owned_(std::move(toks)) {
+    tokens_.reserve(owned_.size());
+    for (const auto& t : owned_) tokens_.push_back({t.type, t.lexeme, t.line, t.column});
+    cur_ = pull();
 }
 
 /**
- * \brief Sayı, değişken veya parantezli ifade çözümler.
- * \return Çözümlenen faktör düğümü
+ * \brief İfadeyi öncelik tırmanma ile, özyineleme olmadan çözümler.
+ * \return Çözümlenen ifade düğümü; hata varsa nullptr
+ *
+ * İşlenenler operands_, bekleyen operatörler ve açık parantezler ops_
+ * yığınında tutulur. Gelen ikili operatörden önce, önceliği ondan düşük
+ * olmayan operatörler indirgenir (sola birleşme); `)` ilk `(`'e kadar
+ * indirger. Böylece parantez derinliği çağrı yığınını değil yalnızca bu
+ * vektörleri büyütür ve her işlenen için öncelik düzeyi başına bir çağrı
+ * yapılmaz.
  */
-std::unique_ptr<Expr> Parser::parse_factor() const {
-    const Token& t = peek();
-    if (t.type == TokenType::Number) { advance(); return std::make_unique<NumberExpr>(std::stod(t.lexeme)); }
-    if (t.type == TokenType::Identifier) { advance(); return std::make_unique<VariableExpr>(t.lexeme); }
-    if (t.type == TokenType::LParen) { advance(); auto e = parse_expression(); if (!match(TokenType::RParen)) throw std::runtime_error("Expected )"); return e; }
-    throw std::runtime_error("Unexpected token in factor");
+Expr* Parser::parse_expression() const {
+    const std::size_t obase = operands_.size(), pbase = ops_.size();
+    auto fail = [&](const char* message) -> Expr* {
+        operands_.resize(obase); ops_.resize(pbase);
+        return error(message);
+    };
+    auto reduce = [&]{
+        const char op = ops_.back(); ops_.pop_back();
+        Expr* r = operands_.back(); operands_.pop_back();
+        if (op == 'u'){
+            if (r->kind() == ExprKind::Number){ auto* n = static_cast<NumberExpr*>(r); n->value = 0.0 - n->value; }
+            else r = arena_->make<BinaryExpr>('-', arena_->make<NumberExpr>(0.0), r);
+            operands_.push_back(r);
+            return;
+        }
+        Expr*& l = operands_.back();
+        l = arena_->make<BinaryExpr>(op, l, r);
+    };
+    for (;;){
+        // İşlenen bekleniyor: önek operatörleri ve açılan parantezler yığına.
+        const TokenView t = peek();
+        if (t.type == TokenType::Minus){ advance(); ops_.push_back('u'); continue; }
+        if (t.type == TokenType::Plus){ advance(); continue; }
+        if (t.type == TokenType::LParen){ advance(); ops_.push_back('('); continue; }
+        if (t.type == TokenType::Number){
+            double v = 0;
+            if (!parse_number(t, v)) return fail("Invalid number");
+            advance(); operands_.push_back(arena_->make<NumberExpr>(v));
+        } else if (t.type == TokenType::Identifier){
+            advance(); SymbolId id = symbols_->intern(t.lexeme);
+            operands_.push_back(arena_->make<VariableExpr>(id, symbols_->name(id)));
+        } else {
+            return fail("Unexpected token in factor");
+        }
+        // Operatör bekleniyor: önce bu ifadede açılmış parantezleri kapat.
+        while (peek().type == TokenType::RParen){
+            while (ops_.size() > pbase && ops_.back() != '(') reduce();
+            if (ops_.size() == pbase) break;
+            ops_.pop_back(); advance();
+        }
+        const char op = binary_op(peek().type);
+        if (!op) break;
+        while (ops_.size() > pbase && precedence(ops_.back()) >= precedence(op)) reduce();
+        ops_.push_back(op); advance();
+    }
+    while (ops_.size() > pbase){
+        if (ops_.back() == '(') return fail("Expected )");
+        reduce();
+    }
+    Expr* e = operands_.back(); operands_.pop_back();
+    return e;
 }
 
 /**
  * \brief Tek bir deyimi (ve varsa satır etiketini) çözümler.
  * \param[out] outLabel Deyimin satır etiketi; yoksa -1 olur.
- * \return Çözümlenen deyim düğümü
+ * \return Çözümlenen deyim düğümü; hata varsa nullptr (hata kaydedilmiştir)
  */
-std::unique_ptr<Stmt> Parser::parse_statement(int& outLabel) const {
+Stmt* Parser::parse_statement(int& outLabel) const {
     outLabel = -1;
     // Optional line label at start of a line: Number ...
     if (peek().type == TokenType::Number) {
-        // Only treat as label if followed by something other than Eof/Newline
-        int label = std::stoi(peek().lexeme);
-        // Lookahead without consuming statement token kinds
-        // We'll accept this as label and move on
+        int label = 0;
+        if (!parse_line_number(peek(), label)) return error("Invalid line number");
         advance();
         outLabel = label;
     }
@@ -81,80 +164,205 @@ std::unique_ptr<Stmt> Parser::parse_statement(int& outLabel) const {
     // Skip any extra newlines between label and statement
     while (match(TokenType::Newline)) {}
 
-    const Token& t = peek();
+    const TokenView t = peek();
     if (t.type == TokenType::KW_LET) {
         advance();
-        if (peek().type != TokenType::Identifier) throw std::runtime_error("Expected identifier after LET");
-        std::string name = advance().lexeme;
-        if (!match(TokenType::Assign)) throw std::runtime_error("Expected = in LET");
+        if (peek().type != TokenType::Identifier) return error("Expected identifier after LET");
+        SymbolId id = symbols_->intern(advance().lexeme);
+        if (!match(TokenType::Assign)) return error("Expected = in LET");
         auto e = parse_expression();
+        if (!e) return nullptr;
         // consume optional trailing newline
         if (peek().type == TokenType::Newline) advance();
-        return std::make_unique<LetStmt>(std::move(name), std::move(e));
+        return arena_->make<LetStmt>(id, symbols_->name(id), e);
     }
     if (t.type == TokenType::KW_PRINT) {
-        advance(); std::vector<std::unique_ptr<Expr>> items;
-        items.push_back(parse_expression());
-        while (match(TokenType::Comma)) items.push_back(parse_expression());
+        advance(); items_.clear();
+        do {
+            Expr* e = parse_expression();
+            if (!e) return nullptr;
+            items_.push_back(e);
+        } while (match(TokenType::Comma));
         if (peek().type == TokenType::Newline) advance();
-        return std::make_unique<PrintStmt>(std::move(items));
+        return arena_->make<PrintStmt>(NodeList<Expr>{arena_->copy_array(items_.data(), items_.size()), items_.size()});
     }
     if (t.type == TokenType::KW_INPUT) {
-        advance(); if (peek().type != TokenType::Identifier) throw std::runtime_error("Expected identifier after INPUT");
-        std::string name = advance().lexeme; if (peek().type == TokenType::Newline) advance();
-        return std::make_unique<InputStmt>(std::move(name));
+        advance(); if (peek().type != TokenType::Identifier) return error("Expected identifier after INPUT");
+        SymbolId id = symbols_->intern(advance().lexeme); if (peek().type == TokenType::Newline) advance();
+        return arena_->make<InputStmt>(id, symbols_->name(id));
     }
+    int target = 0;
     if (t.type == TokenType::KW_GOTO) {
-        advance(); if (peek().type != TokenType::Number) throw std::runtime_error("Expected line number after GOTO");
-        int target = std::stoi(advance().lexeme); if (peek().type == TokenType::Newline) advance();
-        return std::make_unique<GotoStmt>(target);
+        advance(); if (!parse_line_number(peek(), target)) return error("Expected line number after GOTO");
+        advance(); if (peek().type == TokenType::Newline) advance();
+        return arena_->make<GotoStmt>(target);
     }
     if (t.type == TokenType::KW_IF) {
         advance(); auto cond = parse_expression();
-        if (peek().type != TokenType::KW_THEN) throw std::runtime_error("Expected THEN");
+        if (!cond) return nullptr;
+        if (peek().type != TokenType::KW_THEN) return error("Expected THEN");
         advance();
         if (peek().type == TokenType::KW_GOTO) advance();
-        if (peek().type != TokenType::Number) throw std::runtime_error("Expected line number after THEN");
-        int target = std::stoi(advance().lexeme);
-        if (peek().type == TokenType::Newline) advance();
-        return std::make_unique<IfGotoStmt>(std::move(cond), target);
+        if (!parse_line_number(peek(), target)) return error("Expected line number after THEN");
+        advance(); if (peek().type == TokenType::Newline) advance();
+        return arena_->make<IfGotoStmt>(cond, target);
     }
     if (t.type == TokenType::KW_GOSUB) {
-        advance(); if (peek().type != TokenType::Number) throw std::runtime_error("Expected line number after GOSUB");
-        int target = std::stoi(advance().lexeme); if (peek().type == TokenType::Newline) advance();
-        return std::make_unique<GosubStmt>(target);
+        advance(); if (!parse_line_number(peek(), target)) return error("Expected line number after GOSUB");
+        advance(); if (peek().type == TokenType::Newline) advance();
+        return arena_->make<GosubStmt>(target);
     }
     if (t.type == TokenType::KW_RETURN) {
         advance(); if (peek().type == TokenType::Newline) advance();
-        return std::make_unique<ReturnStmt>();
+        return arena_->make<ReturnStmt>();
+    }
+    if (t.type == TokenType::KW_FOR) {
+        advance();
+        if (peek().type != TokenType::Identifier) return error("Expected identifier after FOR");
+        SymbolId id = symbols_->intern(advance().lexeme);
+        if (!match(TokenType::Assign)) return error("Expected = in FOR");
+        Expr* start = parse_expression();
+        if (!start) return nullptr;
+        if (!match(TokenType::KW_TO)) return error("Expected TO");
+        Expr* limit = parse_expression();
+        if (!limit) return nullptr;
+        Expr* step = nullptr;
+        if (match(TokenType::KW_STEP) && !(step = parse_expression())) return nullptr;
+        if (peek().type == TokenType::Newline) advance();
+        auto* st = arena_->make<ForStmt>(id, symbols_->name(id), start, limit, step);
+        loops_.push_back({id, -1, st, t.line, t.column});
+        return st;
+    }
+    if (t.type == TokenType::KW_NEXT) {
+        if (loops_.empty()) return error("NEXT without FOR");
+        advance();
+        const SymbolId id = loops_.back().id;
+        if (peek().type == TokenType::Identifier){
+            if (symbols_->find(peek().lexeme) != id) return error("NEXT variable does not match FOR");
+            advance();
+        }
+        if (peek().type == TokenType::Newline) advance();
+        return arena_->make<NextStmt>(id, symbols_->name(id));
     }
 
-    throw std::runtime_error("Unknown statement");
+    return error("Unknown statement");
 }
 
 /**
- * \brief Girdi akışının tamamını Program yapısına çözümler.
- * \return Etiketlenmiş deyimlerden oluşan Program
+ * \brief Kabul edilen deyimi açık FOR'larla eşleştirir.
+ * \param st Deyim
+ * \param label Deyimin etiketi
  */
-Program Parser::parseProgram() const {
-    Program prog; prog.labels.clear(); prog.stmts.clear();
+void Parser::link_loops(Stmt* st, int label) const {
+    if (closed_){ closed_->exit = label; closed_ = nullptr; }
+    // FOR'un kendi girdisi parse_statement'ta açıldı; gövde etiketi onu çevreleyen döngüye yazılır.
+    const std::size_t open = loops_.size() - (st->kind() == StmtKind::For ? 1 : 0);
+    if (open > 0 && loops_[open - 1].body < 0) loops_[open - 1].body = label;
+    if (st->kind() != StmtKind::Next) return;
+    // FOR'un hemen ardındaki NEXT kendi etiketine döner: gövde boştur.
+    static_cast<NextStmt*>(st)->body = loops_.back().body;
+    closed_ = loops_.back().node;
+    loops_.pop_back();
+}
+
+/**
+ * \brief Kapanmamış FOR'ları hata olarak kaydeder.
+ *
+ * Bu hatalar girdi sonunda bulunduğundan, liste konuma göre yeniden
+ * sıralanır.
+ */
+void Parser::finish_loops() const {
+    for (const OpenLoop& l : loops_) errors_->push_back({l.line, l.column, "FOR without NEXT"});
+    if (!loops_.empty())
+        std::stable_sort(errors_->begin(), errors_->end(), [](const Diagnostic& a, const Diagnostic& b){
+            return a.line != b.line ? a.line < b.line : a.column < b.column;
+        });
+    loops_.clear(); closed_ = nullptr;
+}
+
+/**
+ * \brief Girdi akışının tamamını hata kurtararak çözümler.
+ * \return Hatasız deyimlerden oluşan Program ve hatalar
+ *
+ * Bir deyim hata verdiğinde satır sonuna kadar atlanır; etiketi programa
+ * eklenmez, dolayısıyla ona yapılan atlamalar olmayan etikete gider.
+ */
+ParseResult Parser::parse() const {
+    ParseResult res;
+    Program& prog = res.program;
+    arena_ = prog.arena.get(); symbols_ = &prog.symbols; errors_ = &res.errors;
+    loops_.clear(); closed_ = nullptr;
     // Consume possible leading newlines
     while (peek().type == TokenType::Newline) advance();
     while (!at_eof()){
         int lbl = -1;
-        auto st = parse_statement(lbl);
-        if (lbl == -1) {
-            // Synthesize a label by stepping +10 from last or start at 10
-            int prev = prog.labels.empty() ? 0 : prog.labels.back();
-            lbl = prev + 10;
+        Stmt* st = parse_statement(lbl);
+        if (!st) {
+            synchronize();
+        } else {
+            if (lbl == -1) {
+                // Synthesize a label by stepping +10 from last or start at 10
+                int prev = prog.labels.empty() ? 0 : prog.labels.back();
+                lbl = prev + 10;
+            }
+            prog.labels.push_back(lbl);
+            prog.stmts.push_back(st);
+            link_loops(st, lbl);
         }
-        prog.labels.push_back(lbl);
-        prog.stmts.push_back(std::move(st));
         // Skip possible blank lines between statements
         while (peek().type == TokenType::Newline) advance();
-        if (peek().type == TokenType::Eof) break;
     }
-    return prog;
+    finish_loops();
+    prog.index = LabelIndex(prog.labels);
+    errors_ = nullptr;
+    return res;
+}
+
+/**
+ * \brief Girdiyi deyim deyim çözümleyip her deyimi alıcıya verir.
+ * \param sink Deyim alıcısı
+ * \return Hatalar
+ */
+std::vector<Diagnostic> Parser::parse_each(const StmtSink& sink) const {
+    std::vector<Diagnostic> errors;
+    Arena arena;
+    Interner symbols;
+    arena_ = &arena; symbols_ = &symbols; errors_ = &errors;
+    loops_.clear(); closed_ = nullptr;
+    int prev = 0;
+    while (peek().type == TokenType::Newline) advance();
+    while (!at_eof()){
+        arena.reset();
+        int lbl = -1;
+        Stmt* st = parse_statement(lbl);
+        if (!st) {
+            synchronize();
+        } else {
+            // parse() ile aynı: etiketsiz deyim bir öncekinin 10 fazlasını alır.
+            if (lbl == -1) lbl = prev + 10;
+            prev = lbl;
+            link_loops(st, lbl);
+            sink(lbl, st, symbols);
+            // Düğümler bir sonraki deyimde silinir; FOR çıkışları alıcının işidir.
+            for (OpenLoop& l : loops_) l.node = nullptr;
+            closed_ = nullptr;
+        }
+        while (peek().type == TokenType::Newline) advance();
+    }
+    finish_loops();
+    arena_ = nullptr; symbols_ = nullptr; errors_ = nullptr;
+    return errors;
+}
+
+/**
+ * \brief Girdi akışının tamamını Program yapısına çözümler.
+ * \return Etiketlenmiş deyimlerden oluşan Program
+ * \throws std::runtime_error Girdide hata varsa
+ */
+Program Parser::parseProgram() const {
+    ParseResult res = parse();
+    if (!res.ok()) throw std::runtime_error(res.errors.front().message);
+    return std::move(res.program);
 }
 
 } // namespace translator
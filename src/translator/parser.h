@@ -9,39 +9,100 @@
 #include <vector>
 #include <memory>
 #include <cstddef>
+#include <functional>
+#include <string>
 #include "translator/token.h"
+#include "translator/lexer.h"
 #include "translator/ast.h"
 
 namespace translator {
 
+/**
+ * @brief Çözümleme sırasında bulunan bir sözdizim hatası
+ */
+struct Diagnostic {
+    int line;             ///< Hatalı belirtecin satırı
+    int column;           ///< Hatalı belirtecin 1 tabanlı sütunu; 0 ise bilinmiyor
+    std::string message;  ///< Hata iletisi (ör. "Expected )")
+};
+
+/**
+ * @brief Hata kurtarmalı çözümlemenin sonucu
+ *
+ * Hatalı deyimler programa alınmaz; program geri kalan deyimlerden oluşur.
+ */
+struct ParseResult {
+    Program program;                  ///< Hatasız çözümlenen deyimler
+    std::vector<Diagnostic> errors;   ///< Kaynak sırasıyla hatalar
+
+    /** @brief Hiç hata yoksa true. */
+    bool ok() const noexcept { return errors.empty(); }
+};
+
 /**
  * @brief BASIC benzeri dilin sözdizim çözümleyicisi
  * 
  * Bu sınıf, token dizisini alarak Abstract Syntax Tree (AST) üretir.
- * Recursive descent parsing algoritması kullanır.
+ * Deyimler recursive descent ile, ifadeler açık yığınlı öncelik tırmanma
+ * (precedence climbing) ile çözümlenir; iç içe parantez derinliği çağrı
+ * yığınını tüketmez.
+ *
+ * Hatalar istisna fırlatılmadan toplanır: hatalı deyim bırakılır ve
+ * çözümleme bir sonraki satır sonundan (panik kipi) devam eder. NEXT en
+ * içteki açık FOR'a bağlanır; eşleşmeyen NEXT ile kapanmayan FOR da birer
+ * hatadır ve satır sırasıyla raporlanır.
  */
 class Parser {
-    const std::vector<Token> tokens_;  ///< Çözümlenecek token dizisi
-    mutable std::size_t pos_ = 0;      ///< Mevcut pozisyon
+    /// Kaynakta NEXT'i henüz görülmemiş bir FOR.
+    struct OpenLoop {
+        SymbolId id;       ///< Döngü değişkeni
+        int body;          ///< FOR'dan sonraki deyimin etiketi; henüz yoksa -1
+        ForStmt* node;     ///< FOR düğümü; parse_each'te deyim bitince nullptr
+        int line, column;  ///< FOR anahtar sözcüğünün konumu
+    };
+
+    std::vector<Token> owned_;             ///< Sahiplenilen token dizisi (Token kurucusu için)
+    std::vector<TokenView> tokens_;        ///< Önceden üretilmiş token görünümleri
+    std::function<TokenView()> source_;    ///< Artımlı token kaynağı (boşsa tokens_ kullanılır)
+    mutable std::size_t pos_ = 0;          ///< tokens_ içindeki bir sonraki konum
+    mutable TokenView cur_{TokenType::Eof, {}, 0};  ///< Mevcut (bakılan) token
+    mutable Arena* arena_ = nullptr;       ///< Çözümlenen Program'ın düğüm bölgesi
+    mutable Interner* symbols_ = nullptr;  ///< Çözümlenen Program'ın ad tablosu
+    mutable std::vector<Expr*> items_;     ///< PRINT öğeleri için yeniden kullanılan tampon
+    mutable std::vector<Expr*> operands_;  ///< parse_expression() işlenen yığını
+    mutable std::vector<char> ops_;        ///< parse_expression() operatör / '(' yığını
+    mutable std::vector<Diagnostic>* errors_ = nullptr;  ///< Çözümlenen programın hata listesi
+    mutable std::vector<OpenLoop> loops_;  ///< Açık FOR'lar, en içteki sonda
+    mutable ForStmt* closed_ = nullptr;    ///< Çıkış etiketini bir sonraki deyimden alacak FOR
+
+    /**
+     * @brief Kaynaktan bir sonraki token'ı çeker
+     * @return Çekilen token; kaynak bittiyse Eof
+     */
+    TokenView pull() const {
+        if (source_) return source_();
+        if (pos_ < tokens_.size()) return tokens_[pos_++];
+        return tokens_.empty() ? TokenView{TokenType::Eof, {}, 0} : tokens_.back();
+    }
 
     /**
      * @brief Mevcut token'ı döndürür (ilerlemeden)
      * @return Mevcut token'ın referansı
      */
-    const Token& peek() const { return tokens_[pos_]; }
+    const TokenView& peek() const { return cur_; }
     
     /**
-     * @brief Mevcut token'ı döndürür ve pozisyonu ilerletir
-     * @return Mevcut token'ın referansı
+     * @brief Mevcut token'ı döndürür ve bir sonrakini çeker
+     * @return İlerlemeden önceki token
      */
-    const Token& advance() const { return tokens_[pos_++]; }
+    TokenView advance() const { TokenView t = cur_; cur_ = pull(); return t; }
     
     /**
      * @brief Mevcut token'ın belirtilen türde olup olmadığını kontrol eder
      * @param t Kontrol edilecek token türü
      * @return true eğer token türü eşleşirse ve pozisyon ilerletilirse
      */
-    bool match(TokenType t) const { if (peek().type == t) { ++pos_; return true; } return false; }
+    bool match(TokenType t) const { if (peek().type == t) { advance(); return true; } return false; }
     
     /**
      * @brief Dosya sonuna gelinip gelinmediğini kontrol eder
@@ -49,42 +110,117 @@ class Parser {
      */
     bool at_eof() const { return peek().type == TokenType::Eof; }
 
+    /**
+     * @brief Mevcut belirteç konumunda bir hata kaydeder
+     * @param message Hata iletisi
+     * @return Her zaman nullptr; çağıranlar doğrudan döndürebilir
+     */
+    std::nullptr_t error(const char* message) const {
+        errors_->push_back({peek().line, peek().column, message});
+        return nullptr;
+    }
+
+    /**
+     * @brief Panik kipi: bir sonraki satır sonuna (ya da girdi sonuna) kadar atlar
+     */
+    void synchronize() const { while (!at_eof() && peek().type != TokenType::Newline) advance(); }
+
     // Parsing helpers
     /**
-     * @brief İfade çözümler
-     * @return Çözümlenen ifade AST'i
+     * @brief İfade çözümler (karşılaştırma < toplama < çarpma < tekli eksi)
+     * @return Çözümlenen ifade AST'i (arena_ içinde); hata varsa nullptr
      */
-    std::unique_ptr<Expr> parse_expression() const;
+    Expr* parse_expression() const;
     
     /**
-     * @brief Terim çözümler
-     * @return Çözümlenen terim AST'i
+     * @brief Deyim çözümler
+     * @param outLabel Çıktı etiketi referansı
+     * @return Çözümlenen deyim AST'i (arena_ içinde); hata varsa nullptr
      */
-    std::unique_ptr<Expr> parse_term() const;
-    
+    Stmt* parse_statement(int& outLabel) const;
+
     /**
-     * @brief Faktör çözümler
-     * @return Çözümlenen faktör AST'i
+     * @brief Kabul edilen deyimi açık FOR'larla eşleştirir
+     * @param st Deyim
+     * @param label Deyimin etiketi
+     *
+     * Bir önceki NEXT'in FOR'una çıkış, en içteki açık FOR'a gövde
+     * etiketi olarak bu deyimin etiketi yazılır; NEXT ise en içteki açık
+     * FOR'u kapatır (eşleşme parse_statement'ta doğrulanmıştır).
      */
-    std::unique_ptr<Expr> parse_factor() const;
+    void link_loops(Stmt* st, int label) const;
 
     /**
-     * @brief Deyim çözümler
-     * @param outLabel Çıktı etiketi referansı
-     * @return Çözümlenen deyim AST'i
+     * @brief Kapanmamış FOR'ları hata olarak kaydeder ve hataları kaynak sırasına dizer
      */
-    std::unique_ptr<Stmt> parse_statement(int& outLabel) const;
+    void finish_loops() const;
 
 public:
     /**
      * @brief Belirteç dizisi ile parser oluşturur
      * @param toks Çözümlenecek token dizisi
      */
-    explicit Parser(std::vector<Token> toks): tokens_(std::move(toks)) {}
+    explicit Parser(std::vector<Token> toks);
+
+    /**
+     * @brief Kopyasız token görünümleri ile parser oluşturur
+     * @param toks Çözümlenecek görünümler; işaret ettikleri kaynak
+     *             (ör. Lexer) parser kullanıldığı sürece yaşamalıdır
+     */
+    explicit Parser(std::vector<TokenView> toks): tokens_(std::move(toks)) { cur_ = pull(); }
+
+    /**
+     * @brief Belirteçleri artımlı olarak çeken parser oluşturur
+     * @param source Her çağrıda bir sonraki belirteci döndüren kaynak;
+     *               bittikten sonra Eof döndürmeye devam etmelidir
+     *
+     * Parser yalnızca tek belirteçlik ileri bakış kullanır; bu nedenle
+     * kaynağın, son döndürdüğü ve ondan önceki belirteci geçerli tutması yeterlidir.
+     */
+    explicit Parser(std::function<TokenView()> source): source_(std::move(source)) { cur_ = pull(); }
+
+    /**
+     * @brief Akış lexer'ından belirteç çeken parser oluşturur
+     * @param lexer Belirteç kaynağı; parser kullanıldığı sürece yaşamalıdır
+     */
+    explicit Parser(StreamLexer& lexer): Parser(std::function<TokenView()>([&lexer]{ return lexer.next(); })) {}
+
+    /**
+     * @brief Bellekteki lexer'dan belirteç listesi kurmadan çeken parser oluşturur
+     * @param lexer Belirteç kaynağı; parser kullanıldığı sürece yaşamalıdır
+     */
+    explicit Parser(Lexer& lexer): Parser(std::function<TokenView()>([&lexer]{ return lexer.next(); })) {}
+
+    /// Görünümler owned_ içine işaret edebildiğinden kopyalama yasaktır.
+    Parser(const Parser&) = delete;
+    Parser& operator=(const Parser&) = delete;
     
+    /**
+     * @brief Girişin tamamını hata kurtararak çözümler
+     * @return Hatasız deyimlerden oluşan program ve tüm hatalar
+     *
+     * İstisna fırlatmaz; tek geçişte tüm sözdizim hataları toplanır.
+     */
+    ParseResult parse() const;
+
+    /// parse_each() için deyim alıcısı: (etiket, deyim, ad tablosu).
+    using StmtSink = std::function<void(int, const Stmt*, const Interner&)>;
+
+    /**
+     * @brief Girdiyi deyim deyim çözümler; her deyim tamamlanır tamamlanmaz alıcıya verilir
+     * @param sink Her hatasız deyim için çağrılır; deyim düğümleri yalnızca
+     *             çağrı süresince geçerlidir, ad tablosu çözümleme boyunca
+     * @return parse() ile aynı kurallarla toplanan hatalar
+     *
+     * Düğümler tek bir bölgede tutulur ve her deyimden önce sıfırlanır;
+     * bellek kullanımı dosya boyuna değil en geniş deyime bağlıdır.
+     */
+    std::vector<Diagnostic> parse_each(const StmtSink& sink) const;
+
     /**
      * @brief Girişin tamamını Program yapısına çözümler
      * @return Çözümlenen program AST'i
+     * @throws std::runtime_error Girdide hata varsa; ileti ilk hatanınkidir
      */
     Program parseProgram() const;
 };
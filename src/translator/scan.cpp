@@ -0,0 +1,264 @@
+/**
+ * @file scan.cpp
+ * @brief Lexer tarama çekirdekleri: skaler, SSE2 ve AVX2 uygulamaları ile çalışma zamanı seçimi.
+ */
+#include "translator/scan.h"
+#include <atomic>
+#include <bitset>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define TRANSLATOR_SCAN_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TRANSLATOR_SCAN_SSE2 1
+#endif
+#if defined(__GNUC__) || defined(__clang__)
+#define TRANSLATOR_TARGET_AVX2 __attribute__((target("avx2")))
+#define TRANSLATOR_SCAN_AVX2 1
+#elif defined(_MSC_VER)
+#define TRANSLATOR_TARGET_AVX2
+#define TRANSLATOR_SCAN_AVX2 1
+#endif
+#endif
+
+namespace translator {
+namespace scan {
+
+namespace {
+
+/**
+ * \brief Sıfır olmayan bir maskedeki en düşük bitin konumu.
+ * \param m Maske (m != 0)
+ */
+inline unsigned first_bit(std::uint32_t m){
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long idx; _BitScanForward(&idx, m); return static_cast<unsigned>(idx);
+#else
+    return static_cast<unsigned>(__builtin_ctz(m));
+#endif
+}
+
+/** \brief Maskedeki bit sayısı. */
+inline int bit_count(std::uint32_t m){ return static_cast<int>(std::bitset<32>(m).count()); }
+
+// ---- Skaler (tablo tabanlı) çekirdekler ----
+
+std::size_t scalar_skip(const char* p, std::size_t i, std::size_t n, std::uint8_t cls){
+    while (i<n && is(p[i], cls)) ++i;
+    return i;
+}
+std::size_t scalar_blanks(const char* p, std::size_t i, std::size_t n){ return scalar_skip(p, i, n, Blank); }
+std::size_t scalar_digits(const char* p, std::size_t i, std::size_t n){ return scalar_skip(p, i, n, Digit); }
+std::size_t scalar_ident(const char* p, std::size_t i, std::size_t n){ return scalar_skip(p, i, n, IdentChar); }
+std::size_t scalar_quote(const char* p, std::size_t i, std::size_t n, int& newlines){
+    while (i<n && p[i]!='"'){ if (p[i]=='\n') ++newlines; ++i; }
+    return i;
+}
+
+const Kernels kScalar{Isa::Scalar, scalar_blanks, scalar_digits, scalar_ident, scalar_quote};
+
+#if defined(TRANSLATOR_SCAN_SSE2)
+// ---- SSE2: 16 baytlık bloklar, kalan kuyruk skaler ----
+// Karşılaştırmalar işaretlidir; 0x80 üstü baytlar negatif kalır ve hiçbir sınıfa girmez.
+
+inline __m128i sse2_in_range(__m128i v, char lo, char hi){
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(static_cast<char>(lo-1))), _mm_cmplt_epi8(v, _mm_set1_epi8(static_cast<char>(hi+1))));
+}
+inline __m128i sse2_digit(__m128i v){ return sse2_in_range(v, '0', '9'); }
+inline __m128i sse2_ident(__m128i v){
+    __m128i alpha = sse2_in_range(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+    __m128i under = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+    return _mm_or_si128(_mm_or_si128(alpha, under), sse2_digit(v));
+}
+/// ' ' ve '\t'..'\r' aralığı; aralık '\n'i de kapsar, çağıran ayıklar.
+inline __m128i sse2_blank(__m128i v){
+    return _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), sse2_in_range(v, '\t', '\r'));
+}
+
+template <__m128i (*Match)(__m128i)>
+std::size_t sse2_skip(const char* p, std::size_t i, std::size_t n, std::uint8_t cls){
+    while (i + 16 <= n){
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        std::uint32_t miss = ~static_cast<std::uint32_t>(_mm_movemask_epi8(Match(v))) & 0xFFFFu;
+        if (miss) return i + first_bit(miss);
+        i += 16;
+    }
+    return scalar_skip(p, i, n, cls);
+}
+std::size_t sse2_digits(const char* p, std::size_t i, std::size_t n){ return sse2_skip<sse2_digit>(p, i, n, Digit); }
+std::size_t sse2_ident(const char* p, std::size_t i, std::size_t n){ return sse2_skip<sse2_ident>(p, i, n, IdentChar); }
+std::size_t sse2_blanks(const char* p, std::size_t i, std::size_t n){
+    // Satır sonu bir belirteç olduğundan maskeden çıkarılır.
+    while (i + 16 <= n){
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i m = _mm_andnot_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), sse2_blank(v));
+        std::uint32_t miss = ~static_cast<std::uint32_t>(_mm_movemask_epi8(m)) & 0xFFFFu;
+        if (miss) return i + first_bit(miss);
+        i += 16;
+    }
+    return scalar_blanks(p, i, n);
+}
+std::size_t sse2_quote(const char* p, std::size_t i, std::size_t n, int& newlines){
+    while (i + 16 <= n){
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        std::uint32_t q = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('"'))));
+        std::uint32_t nl = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))));
+        if (q){ unsigned k = first_bit(q); newlines += bit_count(nl & ((1u << k) - 1u)); return i + k; }
+        newlines += bit_count(nl); i += 16;
+    }
+    return scalar_quote(p, i, n, newlines);
+}
+
+const Kernels kSSE2{Isa::SSE2, sse2_blanks, sse2_digits, sse2_ident, sse2_quote};
+#endif
+
+#if defined(TRANSLATOR_SCAN_AVX2)
+// ---- AVX2: 32 baytlık bloklar; yalnızca çalışma zamanında destek doğrulanınca çağrılır ----
+
+TRANSLATOR_TARGET_AVX2 inline __m256i avx2_in_range(__m256i v, char lo, char hi){
+    return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(static_cast<char>(lo-1))), _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(hi+1)), v));
+}
+TRANSLATOR_TARGET_AVX2 inline std::uint32_t avx2_miss(__m256i m){ return ~static_cast<std::uint32_t>(_mm256_movemask_epi8(m)); }
+TRANSLATOR_TARGET_AVX2 inline __m256i avx2_load(const char* p){ return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+
+TRANSLATOR_TARGET_AVX2 std::size_t avx2_digits(const char* p, std::size_t i, std::size_t n){
+    while (i + 32 <= n){
+        std::uint32_t miss = avx2_miss(avx2_in_range(avx2_load(p + i), '0', '9'));
+        if (miss) return i + first_bit(miss);
+        i += 32;
+    }
+    return scalar_digits(p, i, n);
+}
+TRANSLATOR_TARGET_AVX2 std::size_t avx2_ident(const char* p, std::size_t i, std::size_t n){
+    while (i + 32 <= n){
+        __m256i v = avx2_load(p + i);
+        __m256i alpha = avx2_in_range(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z');
+        __m256i m = _mm256_or_si256(_mm256_or_si256(alpha, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'))), avx2_in_range(v, '0', '9'));
+        std::uint32_t miss = avx2_miss(m);
+        if (miss) return i + first_bit(miss);
+        i += 32;
+    }
+    return scalar_ident(p, i, n);
+}
+TRANSLATOR_TARGET_AVX2 std::size_t avx2_blanks(const char* p, std::size_t i, std::size_t n){
+    while (i + 32 <= n){
+        __m256i v = avx2_load(p + i);
+        __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), avx2_in_range(v, '\t', '\r'));
+        m = _mm256_andnot_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')), m);
+        std::uint32_t miss = avx2_miss(m);
+        if (miss) return i + first_bit(miss);
+        i += 32;
+    }
+    return scalar_blanks(p, i, n);
+}
+TRANSLATOR_TARGET_AVX2 std::size_t avx2_quote(const char* p, std::size_t i, std::size_t n, int& newlines){
+    while (i + 32 <= n){
+        __m256i v = avx2_load(p + i);
+        std::uint32_t q = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"'))));
+        std::uint32_t nl = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'))));
+        if (q){ unsigned k = first_bit(q); newlines += bit_count(nl & ((1u << k) - 1u)); return i + k; }
+        newlines += bit_count(nl); i += 32;
+    }
+    return scalar_quote(p, i, n, newlines);
+}
+
+const Kernels kAVX2{Isa::AVX2, avx2_blanks, avx2_digits, avx2_ident, avx2_quote};
+
+/** \brief İşlemci ve işletim sistemi AVX2'yi destekliyor mu? */
+bool cpu_has_avx2(){
+#if defined(_MSC_VER) && !defined(__clang__)
+    int r[4]; __cpuid(r, 0); if (r[0] < 7) return false;
+    __cpuid(r, 1); bool osxsave = (r[2] & (1 << 27)) != 0, avx = (r[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) return false;
+    __cpuidex(r, 7, 0); return (r[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+#endif
+
+/** \brief Etkin çekirdek tablosu (nullptr: henüz seçilmedi). */
+std::atomic<const Kernels*> g_active{nullptr};
+
+} // namespace
+
+/**
+ * \brief Çalışan işlemcinin desteklediği en geniş komut kümesi.
+ * \return AVX2, SSE2 ya da Scalar
+ */
+Isa best_supported() noexcept {
+    if (supported(Isa::AVX2)) return Isa::AVX2;
+    if (supported(Isa::SSE2)) return Isa::SSE2;
+    return Isa::Scalar;
+}
+
+/**
+ * \brief Verilen komut kümesinin bu derleme ve işlemcide kullanılabilirliği.
+ * \param isa Komut kümesi
+ * \return Kullanılabiliyorsa true
+ */
+bool supported(Isa isa) noexcept {
+    switch (isa){
+        case Isa::Scalar: return true;
+        case Isa::SSE2:
+#if defined(TRANSLATOR_SCAN_SSE2)
+            return true;
+#else
+            return false;
+#endif
+        case Isa::AVX2: {
+#if defined(TRANSLATOR_SCAN_AVX2)
+            static const bool has = cpu_has_avx2();
+            return has;
+#else
+            return false;
+#endif
+        }
+    }
+    return false;
+}
+
+/**
+ * \brief Komut kümesine ait çekirdekleri döndürür.
+ * \param isa Komut kümesi
+ * \return Desteklenmiyorsa skaler çekirdekler
+ */
+const Kernels& kernels_for(Isa isa) noexcept {
+    if (!supported(isa)) return kScalar;
+    switch (isa){
+#if defined(TRANSLATOR_SCAN_AVX2)
+        case Isa::AVX2: return kAVX2;
+#endif
+#if defined(TRANSLATOR_SCAN_SSE2)
+        case Isa::SSE2: return kSSE2;
+#endif
+        default: return kScalar;
+    }
+}
+
+/**
+ * \brief Etkin çekirdekleri döndürür; ilk çağrıda en geniş desteklenen küme seçilir.
+ */
+const Kernels& active() noexcept {
+    const Kernels* k = g_active.load(std::memory_order_acquire);
+    if (!k){ k = &kernels_for(best_supported()); g_active.store(k, std::memory_order_release); }
+    return *k;
+}
+
+/**
+ * \brief Etkin çekirdekleri değiştirir.
+ * \param isa İstenen komut kümesi
+ * \return Desteklenmiyorsa false
+ */
+bool select(Isa isa) noexcept {
+    if (!supported(isa)) return false;
+    g_active.store(&kernels_for(isa), std::memory_order_release);
+    return true;
+}
+
+} // namespace scan
+} // namespace translator
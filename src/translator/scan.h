@@ -0,0 +1,95 @@
+/**
+ * @file scan.h
+ * @brief Lexer için yerel ayardan bağımsız karakter sınıfları ve SIMD tarama çekirdekleri
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace translator {
+namespace scan {
+
+/**
+ * @brief Karakter sınıfı bitleri
+ */
+enum CharClass : std::uint8_t {
+    Blank      = 1,  ///< Satır sonu dışındaki boşluklar (' ', '\\t', '\\v', '\\f', '\\r')
+    Digit      = 2,  ///< '0'..'9'
+    IdentStart = 4,  ///< Harf veya '_'
+    IdentChar  = 8   ///< Harf, rakam veya '_'
+};
+
+/** @brief "C" yerel ayarındaki isspace/isdigit/isalpha ile aynı sınıflandırmayı üretir. */
+constexpr std::array<std::uint8_t, 256> make_char_classes() noexcept {
+    std::array<std::uint8_t, 256> t{};
+    for (int c = 0; c < 256; ++c) {
+        std::uint8_t m = 0;
+        bool alpha = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+        bool digit = c >= '0' && c <= '9';
+        if (c == ' ' || c == '\t' || c == '\v' || c == '\f' || c == '\r') m |= Blank;
+        if (digit) m |= Digit;
+        if (alpha || c == '_') m |= IdentStart;
+        if (alpha || digit || c == '_') m |= IdentChar;
+        t[static_cast<std::size_t>(c)] = m;
+    }
+    return t;
+}
+
+/** @brief Bayt başına karakter sınıfı tablosu. */
+inline constexpr std::array<std::uint8_t, 256> kCharClass = make_char_classes();
+
+/** @brief c karakteri verilen sınıf bitlerinden birine sahip mi? */
+inline bool is(char c, std::uint8_t cls) noexcept { return (kCharClass[static_cast<unsigned char>(c)] & cls) != 0; }
+
+/**
+ * @brief Tarama çekirdeklerinin komut kümesi
+ */
+enum class Isa {
+    Scalar,  ///< Tablo tabanlı, bayt bayt
+    SSE2,    ///< 16 bayt blok
+    AVX2     ///< 32 bayt blok
+};
+
+/**
+ * @brief Bir komut kümesine ait tarama işlevleri
+ * 
+ * Tüm işlevler p[i..n) aralığını tarar ve koşulu sağlamayan ilk konumu
+ * (yoksa n) döndürür; n'nin ötesini asla okumaz.
+ */
+struct Kernels {
+    Isa isa;  ///< Çekirdeklerin komut kümesi
+    /// Blank sınıfındaki karakterleri atlar.
+    std::size_t (*skip_blanks)(const char* p, std::size_t i, std::size_t n);
+    /// Rakam dizisinin sonunu bulur.
+    std::size_t (*skip_digits)(const char* p, std::size_t i, std::size_t n);
+    /// Tanımlayıcı karakterlerinin sonunu bulur.
+    std::size_t (*skip_ident)(const char* p, std::size_t i, std::size_t n);
+    /// İlk '"' karakterini bulur; atlanan '\\n' sayısını newlines'a ekler.
+    std::size_t (*find_quote)(const char* p, std::size_t i, std::size_t n, int& newlines);
+};
+
+/** @brief Çalışan işlemcinin desteklediği en geniş komut kümesi. */
+Isa best_supported() noexcept;
+
+/** @brief Verilen komut kümesi bu işlemcide kullanılabilir mi? */
+bool supported(Isa isa) noexcept;
+
+/** @brief Verilen komut kümesinin çekirdekleri (desteklenmiyorsa skaler). */
+const Kernels& kernels_for(Isa isa) noexcept;
+
+/** @brief Lexer'ın kullandığı etkin çekirdekler (ilk kullanımda best_supported()). */
+const Kernels& active() noexcept;
+
+/**
+ * @brief Etkin çekirdekleri değiştirir
+ * @param isa İstenen komut kümesi
+ * @return Desteklenmiyorsa false (etkin seçim değişmez)
+ */
+bool select(Isa isa) noexcept;
+
+} // namespace scan
+} // namespace translator
@@ -0,0 +1,159 @@
+/**
+ * @file source.cpp
+ * @brief SourceBuffer uygulaması: POSIX mmap / Win32 MapViewOfFile ve read() yedeği.
+ */
+#include "translator/source.h"
+#include <cerrno>
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <cstdio>
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace translator {
+
+namespace {
+
+#if defined(_WIN32)
+
+/**
+ * \brief Dosyayı salt okunur olarak eşlemeyi dener.
+ * \return Eşleme başarılıysa true
+ */
+bool try_map(const std::string& path, SourceMode mode, const char*& out, std::size_t& size){
+    HANDLE f = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (f == INVALID_HANDLE_VALUE) throw std::runtime_error("Cannot open input: " + path);
+    LARGE_INTEGER len{};
+    bool ok = GetFileType(f) == FILE_TYPE_DISK && GetFileSizeEx(f, &len) && len.QuadPart > 0
+        && (mode == SourceMode::Map || static_cast<std::size_t>(len.QuadPart) >= SourceBuffer::kAutoMapThreshold);
+    if (ok){
+        HANDLE m = CreateFileMappingA(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* v = m ? MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (m) CloseHandle(m);
+        ok = v != nullptr;
+        if (ok){ out = static_cast<const char*>(v); size = static_cast<std::size_t>(len.QuadPart); }
+    }
+    CloseHandle(f);
+    return ok;
+}
+
+/** \brief Eşlenmiş bölgeyi bırakır. */
+void unmap(const char* p, std::size_t){ UnmapViewOfFile(p); }
+
+/** \brief Dosyanın (ya da "-" için standart girdinin) tamamını okur. */
+std::string read_all(const std::string& path){
+    FILE* f = path == "-" ? stdin : std::fopen(path.c_str(), "rb");
+    if (!f) throw std::runtime_error("Cannot open input: " + path);
+    if (f == stdin) _setmode(_fileno(stdin), _O_BINARY);
+    std::string out; char chunk[1 << 16]; std::size_t got;
+    while ((got = std::fread(chunk, 1, sizeof(chunk), f)) > 0) out.append(chunk, got);
+    bool failed = std::ferror(f) != 0;
+    if (f != stdin) std::fclose(f);
+    if (failed) throw std::runtime_error("Cannot read input: " + path);
+    return out;
+}
+
+#else
+
+/**
+ * \brief Normal bir dosyayı salt okunur olarak eşlemeyi dener.
+ * \return Eşleme başarılıysa true
+ */
+bool try_map(const std::string& path, SourceMode mode, const char*& out, std::size_t& size){
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Cannot open input: " + path);
+    struct stat st{};
+    bool ok = ::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0
+        && (mode == SourceMode::Map || static_cast<std::size_t>(st.st_size) >= SourceBuffer::kAutoMapThreshold);
+    if (ok){
+        void* v = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ok = v != MAP_FAILED;
+        if (ok){
+            ::madvise(v, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+            out = static_cast<const char*>(v); size = static_cast<std::size_t>(st.st_size);
+        }
+    }
+    ::close(fd);
+    return ok;
+}
+
+/** \brief Eşlenmiş bölgeyi bırakır. */
+void unmap(const char* p, std::size_t n){ ::munmap(const_cast<char*>(p), n); }
+
+/** \brief Dosyanın (ya da "-" için standart girdinin) tamamını read() ile okur. */
+std::string read_all(const std::string& path){
+    int fd = path == "-" ? 0 : ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Cannot open input: " + path);
+    std::string out;
+    struct stat st{};
+    if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) out.reserve(static_cast<std::size_t>(st.st_size));
+    char chunk[1 << 16];
+    for (;;){
+        ssize_t got = ::read(fd, chunk, sizeof(chunk));
+        if (got > 0) { out.append(chunk, static_cast<std::size_t>(got)); continue; }
+        if (got == 0) break;
+        if (errno == EINTR) continue;
+        if (fd != 0) ::close(fd);
+        throw std::runtime_error("Cannot read input: " + path);
+    }
+    if (fd != 0) ::close(fd);
+    return out;
+}
+
+#endif
+
+} // namespace
+
+/**
+ * \brief Dosyayı verilen biçimde yükler.
+ * \param path Dosya yolu ("-" standart girdi)
+ * \param mode Yükleme biçimi
+ * \return Yüklenen tampon
+ */
+SourceBuffer SourceBuffer::open(const std::string& path, SourceMode mode){
+    SourceBuffer b;
+    if (mode != SourceMode::Read && path != "-" && try_map(path, mode, b.map_, b.map_size_)) return b;
+    b.data_ = read_all(path);
+    return b;
+}
+
+/**
+ * \brief Bellekteki metni sahiplenen tampon oluşturur.
+ * \param text Kaynak metin
+ */
+SourceBuffer SourceBuffer::from_string(std::string text){
+    SourceBuffer b; b.data_ = std::move(text); return b;
+}
+
+/** \brief Eşleme varsa bırakır. */
+void SourceBuffer::release() noexcept {
+    if (map_) unmap(map_, map_size_);
+    map_ = nullptr; map_size_ = 0;
+}
+
+SourceBuffer::SourceBuffer(SourceBuffer&& o) noexcept
+    : data_(std::move(o.data_)), map_(std::exchange(o.map_, nullptr)), map_size_(std::exchange(o.map_size_, 0)) {}
+
+SourceBuffer& SourceBuffer::operator=(SourceBuffer&& o) noexcept {
+    if (this != &o){
+        release();
+        data_ = std::move(o.data_);
+        map_ = std::exchange(o.map_, nullptr);
+        map_size_ = std::exchange(o.map_size_, 0);
+    }
+    return *this;
+}
+
+} // namespace translator
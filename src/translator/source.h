@@ -0,0 +1,66 @@
+/**
+ * @file source.h
+ * @brief Kaynak dosyayı belleğe eşleyen (mmap) ya da okuyan girdi tamponu
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace translator {
+
+/**
+ * @brief Girdinin nasıl yükleneceği
+ */
+enum class SourceMode {
+    Auto,  ///< Büyük normal dosyalar eşlenir, diğerleri okunur
+    Map,   ///< Bellek eşleme (eşlenemiyorsa okumaya düşer)
+    Read   ///< read() ile tampona kopyalama
+};
+
+/**
+ * @brief Salt okunur kaynak tamponu
+ * 
+ * Normal dosyalar mmap/MapViewOfFile ile kopyasız olarak eşlenir; borular,
+ * standart girdi ("-") ve eşlenemeyen dosyalar read() ile okunur. Lexer
+ * view() üzerinden doğrudan tarama yapar. Taşınabilir, kopyalanamaz.
+ */
+class SourceBuffer {
+    std::string data_;          ///< Okuma modunda içerik
+    const char* map_ = nullptr; ///< Eşlenmiş bölgenin başı
+    std::size_t map_size_ = 0;  ///< Eşlenmiş bölgenin boyu
+
+    void release() noexcept;
+public:
+    /// Auto modunda bu boyuttan (bayt) büyük dosyalar eşlenir.
+    static constexpr std::size_t kAutoMapThreshold = 1u << 20;
+
+    /**
+     * @brief Dosyayı açar ve içeriğini yükler
+     * @param path Dosya yolu; "-" standart girdi
+     * @param mode Yükleme biçimi
+     * @return Yüklenen tampon
+     * @throws std::runtime_error dosya açılamaz ya da okunamazsa
+     */
+    static SourceBuffer open(const std::string& path, SourceMode mode = SourceMode::Auto);
+
+    /** @brief Bellekteki metinden tampon oluşturur. */
+    static SourceBuffer from_string(std::string text);
+
+    SourceBuffer() = default;
+    ~SourceBuffer() { release(); }
+    SourceBuffer(SourceBuffer&& o) noexcept;
+    SourceBuffer& operator=(SourceBuffer&& o) noexcept;
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+
+    /** @brief Tamponun içeriği. */
+    std::string_view view() const noexcept { return map_ ? std::string_view(map_, map_size_) : std::string_view(data_); }
+    /** @brief İçerik bellek eşleme ile mi yüklendi? */
+    bool mapped() const noexcept { return map_ != nullptr; }
+};
+
+} // namespace translator
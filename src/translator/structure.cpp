@@ -0,0 +1,151 @@
+/**
+ * @file structure.cpp
+ * @brief Yapısal kontrol akışı çıkarımının uygulaması.
+ */
+#include "translator/structure.h"
+#include <algorithm>
+
+namespace translator {
+
+namespace {
+
+/** \brief Kapalı indeks aralığı. */
+struct Range { int lo, hi; };
+
+/**
+ * \brief Bölgenin alt bölgelerin yerleşebileceği gövde aralıkları.
+ * \param r Bölge
+ * \param out En fazla iki aralık
+ * \return Aralık sayısı
+ *
+ * Bölgeyi oluşturan deyimler (döngü kapanışı, IF, else öncesi GOTO)
+ * gövdeye dahil değildir.
+ */
+int bodies(const Region& r, Range out[2]){
+    switch (r.kind){
+        case RegionKind::Loop: out[0] = {r.begin, r.end - 1}; return 1;
+        case RegionKind::For: out[0] = {r.begin + 1, r.end - 1}; return 1;
+        case RegionKind::If: out[0] = {r.begin + 1, r.end}; return 1;
+        case RegionKind::IfElse: out[0] = {r.begin + 1, r.split - 2}; out[1] = {r.split, r.end}; return 2;
+    }
+    return 0;
+}
+
+/** \brief Deyim stmt_a'daki etikete atlayabilir mi? */
+bool is_jump(StmtKind k){
+    return k == StmtKind::Goto || k == StmtKind::IfGoto || k == StmtKind::Gosub || k == StmtKind::For || k == StmtKind::Next;
+}
+
+/** \brief `c` bölgesi `parent` gövdelerinden birine tamamen sığıyor mu? */
+bool fits(const Region& parent, const Region& c){
+    Range b[2]; int k = bodies(parent, b);
+    for (int i=0;i<k;++i) if (b[i].lo <= c.begin && c.end <= b[i].hi) return true;
+    return false;
+}
+
+} // namespace
+
+/**
+ * \brief Atlama hedeflerini çözer ve temel blokları bulur.
+ * \param p Düz program
+ * \param cfg Programın CFG'si
+ * \return Bölgesiz çözümleme
+ */
+Structure find_basic_blocks(const FlatProgram& p, const CFG& cfg){
+    Structure st;
+    const int n = static_cast<int>(p.size());
+    st.target.assign(n, -1);
+    st.loop_of.assign(n, -1);
+    for (int i=0;i<n;++i){
+        if (!is_jump(p.stmt_kind[i])) continue;
+        int t = cfg.label_to_index.find(p.stmt_a[i]);
+        if (t != LabelIndex::npos) st.target[i] = t;
+    }
+
+    // Temel bloklar: ilk deyim, atlama hedefleri ve dallanmalardan sonraki deyimler.
+    std::vector<unsigned char> lead(n, 0);
+    if (n > 0) lead[0] = 1;
+    for (int i=0;i<n;++i){
+        if (st.target[i] >= 0) lead[st.target[i]] = 1;
+        const bool branch = is_jump(p.stmt_kind[i]) || p.stmt_kind[i] == StmtKind::Return;
+        if (branch && i + 1 < n) lead[i + 1] = 1;
+    }
+    for (int i=0;i<n;++i) if (lead[i]) st.leaders.push_back(i);
+    return st;
+}
+
+/**
+ * \brief Programın döngülerini ve koşullu dallarını çıkarır.
+ * \param p Düz program
+ * \param cfg Programın CFG'si
+ * \return Yapısal çözümleme
+ */
+Structure recover_structure(const FlatProgram& p, const CFG& cfg){
+    Structure st = find_basic_blocks(p, cfg);
+    const int n = static_cast<int>(p.size());
+    std::vector<unsigned char> targeted(n, 0);
+    std::vector<int> first_src(n, n), last_src(n, -1);   // hedefe atlayan ilk ve son deyim
+    for (int i=0;i<n;++i){
+        const int t = st.target[i];
+        if (t < 0) continue;
+        targeted[t] = 1;
+        first_src[t] = std::min(first_src[t], i);
+        last_src[t] = std::max(last_src[t], i);
+    }
+
+    // Adaylar: FOR'lar sayaçlı döngü, geri kenarlar döngü, ileri IF'ler if ya da if/else.
+    std::vector<Region> cand;
+    for (int i=0;i<n;++i){
+        int t = st.target[i];
+        StmtKind k = p.stmt_kind[i];
+        if (k == StmtKind::For){
+            // Eşleşen NEXT çıkışın hemen öncesindedir (çıkış yoksa son deyimdir) ve FOR'dan sonrakine döner.
+            const int x = t >= 0 ? t - 1 : p.stmt_a[i] < 0 ? n - 1 : -1;
+            if (x <= i || p.stmt_kind[x] != StmtKind::Next || st.target[x] != i + 1) continue;
+            // Gövdeye dışarıdan atlanırsa sınır ve adım FOR'a uğranmadan okunur; C++ for'u bunu ifade edemez.
+            bool closed = true;
+            for (int j=i+1;j<=x && closed;++j) closed = first_src[j] >= i && last_src[j] <= x;
+            if (closed) cand.push_back({RegionKind::For, i, x});
+            continue;
+        }
+        if (t < 0 || k == StmtKind::Gosub) continue;
+        if (t <= i) { cand.push_back({RegionKind::Loop, t, i}); continue; }
+        if (k != StmtKind::IfGoto || t == i + 1) continue;
+        // Else öncesi GOTO koda yazılmadığından başka bir atlamanın hedefi olmamalıdır.
+        int g = t - 1;
+        if (g > i && p.stmt_kind[g] == StmtKind::Goto && st.target[g] > t && !targeted[g])
+            cand.push_back({RegionKind::IfElse, i, st.target[g] - 1, t});
+        cand.push_back({RegionKind::If, i, t - 1});
+    }
+    // Ön-sıra: başlangıç artan, uzunluk azalan; eşitlikte döngü önce.
+    std::stable_sort(cand.begin(), cand.end(), [](const Region& a, const Region& b){
+        if (a.begin != b.begin) return a.begin < b.begin;
+        if (a.end != b.end) return a.end > b.end;
+        return a.kind == RegionKind::Loop && b.kind != RegionKind::Loop;
+    });
+
+    // Açık bölgeler yığını; aday yalnızca en içteki açık bölgeye sığarsa kabul edilir.
+    std::vector<int> open;
+    for (const Region& c : cand){
+        while (!open.empty() && st.regions[open.back()].end < c.begin) open.pop_back();
+        if (!open.empty() && !fits(st.regions[open.back()], c)) continue;
+        // Aynı başlığa dönen iç döngü bir şey katmaz; kapanışı dış döngüde continue olur.
+        if (!open.empty() && c.kind == RegionKind::Loop && st.regions[open.back()].kind == RegionKind::Loop && st.regions[open.back()].begin == c.begin) continue;
+        open.push_back(static_cast<int>(st.regions.size()));
+        st.regions.push_back(c);
+    }
+
+    // Her deyim için en içteki döngü.
+    std::vector<int> loops; std::size_t ri = 0;
+    for (int i=0;i<n;++i){
+        while (!loops.empty() && st.regions[loops.back()].end < i) loops.pop_back();
+        for (; ri < st.regions.size() && st.regions[ri].begin == i; ++ri){
+            const RegionKind k = st.regions[ri].kind;
+            if (k == RegionKind::Loop || k == RegionKind::For) loops.push_back(static_cast<int>(ri));
+        }
+        if (!loops.empty()) st.loop_of[i] = loops.back();
+    }
+    return st;
+}
+
+} // namespace translator
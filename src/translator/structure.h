@@ -0,0 +1,73 @@
+/**
+ * @file structure.h
+ * @brief Düz programdan yapısal kontrol akışı (döngü, if, if/else) çıkarımı
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <vector>
+#include "translator/cfg.h"
+#include "translator/flat_ast.h"
+
+namespace translator {
+
+/**
+ * @brief Yapısal bölge türleri
+ */
+enum class RegionKind {
+    Loop,    ///< [begin..end]: end, begin'e geri atlayan GOTO/IF/NEXT (döngü kapanışı)
+    For,     ///< begin: FOR, end: onu kapatan NEXT; gövde [begin+1..end-1]
+    If,      ///< begin: ileri IF; gövde [begin+1..end] koşul yanlışsa çalışır
+    IfElse   ///< begin: ileri IF; [begin+1..split-2] yanlışsa, [split..end] doğruysa; split-1 bitişe GOTO
+};
+
+/**
+ * @brief Deyim indeksleriyle tanımlanan yapısal bölge
+ */
+struct Region {
+    RegionKind kind;  ///< Bölge türü
+    int begin;        ///< İlk deyim (Loop: başlık, For: FOR, If/IfElse: IF deyimi)
+    int end;          ///< Son deyim (dahil)
+    int split = -1;   ///< IfElse: IF hedefi, yani else kolunun ilk deyimi
+};
+
+/**
+ * @brief Programın yapısal çözümlemesi
+ * 
+ * Bölgeler iç içe geçer (hiçbiri diğerini kesmez) ve ön-sıra ile
+ * saklanır: başlangıca göre artan, aynı başlangıçta dıştaki önce.
+ * Bölgelere sığmayan atlamalar kod üretiminde break/continue ya da
+ * goto olarak kalır.
+ */
+struct Structure {
+    std::vector<Region> regions;   ///< Kabul edilen bölgeler (ön-sıra)
+    std::vector<int> target;       ///< Deyim başına atlama hedefi indeksi (yoksa/bilinmiyorsa -1)
+    std::vector<int> loop_of;      ///< Deyimi içeren en içteki Loop ya da For bölgesinin indeksi (-1: yok)
+    std::vector<int> leaders;      ///< Temel blokların ilk deyimleri (artan sırada)
+};
+
+/**
+ * @brief Atlama hedeflerini çözer ve programı temel bloklara ayırır
+ * @param p Düz program
+ * @param cfg Aynı programın CFG'si
+ * @return `regions` boş, `loop_of` tümüyle -1 olan çözümleme
+ */
+Structure find_basic_blocks(const FlatProgram& p, const CFG& cfg);
+
+/**
+ * @brief Programın döngülerini ve koşullu dallarını çıkarır
+ * @param p Düz program
+ * @param cfg Aynı programın CFG'si (etiket→indeks eşlemesi buradan okunur)
+ * @return Yapısal çözümleme
+ *
+ * Önce find_basic_blocks() çalışır. Döngü adayları FOR/NEXT çiftleri ve
+ * geriye doğru GOTO/IF/NEXT kenarlarıdır; ileri IF'ler if ya da
+ * (koşulsuz bir GOTO ile biten kol varsa) if/else adayıdır. Adaylar
+ * ön-sırayla gezilir ve yalnızca en içteki açık bölgenin gövdesine
+ * tamamen sığanlar kabul edilir; kesişenler indirgenemez kabul edilip
+ * atlama olarak bırakılır.
+ */
+Structure recover_structure(const FlatProgram& p, const CFG& cfg);
+
+} // namespace translator
@@ -6,44 +6,65 @@
  * @version 1.0
  */
 #pragma once
-#include <string>
-#include "ds/hash_table.h"
+#include <cstddef>
+#include <vector>
+#include "translator/interner.h"
 
 namespace translator {
 
 /**
- * @brief İsim→değer eşlemesi yapan tablo
+ * @brief Sembol kimliği→değer eşlemesi yapan tablo
  * 
- * Bu sınıf, BASIC benzeri dildeki değişkenleri saklamak için
- * hash tablosu kullanır. Değişken tanımlama ve atama işlemlerini destekler.
+ * Bu sınıf, BASIC benzeri dildeki değişkenleri saklar. Değişkenler
+ * Interner kimlikleriyle adreslenir; her kimlik bir dizi yuvasıdır, bu
+ * nedenle erişimde ad özeti hesaplanmaz.
  */
 class SymbolTable {
-    ds::HashTable<std::string, double> table_;  ///< Değişken isimlerini ve değerlerini tutan hash tablosu
+    std::vector<double> values_;            ///< Kimlik başına değer
+    std::vector<unsigned char> defined_;    ///< Kimlik başına tanımlı bayrağı
+
+    /// Yuva dizilerini `id`yi içerecek kadar büyütür.
+    void reserve_slot(SymbolId id){ if (id >= values_.size()){ values_.resize(id + 1, 0.0); defined_.resize(id + 1, 0); } }
     
 public:
+    SymbolTable() = default;
+
+    /**
+     * @brief Verilen tablodaki tüm adlar için yuva ayırır
+     * @param names Kimliklerin kaynağı
+     */
+    explicit SymbolTable(const Interner& names): values_(names.size(), 0.0), defined_(names.size(), 0) {}
+
     /**
      * @brief Yeni değişken tanımı ekler veya üzerine yazar
-     * @param name Değişken adı
+     * @param id Değişken kimliği
      * @param value Değişken değeri
      * @return true eğer yeni tanım eklendiyse, false eğer güncellendiyse
      */
-    bool define(const std::string& name, double value){ return table_.insert(name, value); }
+    bool define(SymbolId id, double value){
+        reserve_slot(id);
+        bool fresh = !defined_[id];
+        values_[id] = value; defined_[id] = 1;
+        return fresh;
+    }
     
     /**
      * @brief Var olan değişkene değer atar
-     * @param name Değişken adı
+     * @param id Değişken kimliği
      * @param value Atanacak değer
-     * @return true eğer atama başarılıysa
+     * @return true eğer atama yeni bir tanım oluşturduysa
      */
-    bool assign(const std::string& name, double value){ return table_.insert(name, value); }
+    bool assign(SymbolId id, double value){ return define(id, value); }
     
     /**
-     * @brief Değişken adını arar ve değerinin adresini döndürür
-     * @param name Aranacak değişken adı
-     * @return Değerin const pointer'ı, bulunamazsa nullptr
+     * @brief Değişkenin değerinin adresini döndürür
+     * @param id Aranacak değişken kimliği
+     * @return Değerin const pointer'ı, tanımlı değilse nullptr
      */
-    const double* lookup(const std::string& name) const { return table_.find(name); }
+    const double* lookup(SymbolId id) const { return (id < values_.size() && defined_[id]) ? &values_[id] : nullptr; }
+
+    /** @brief Ayrılmış yuva sayısı. */
+    std::size_t size() const noexcept { return values_.size(); }
 };
 
 } // namespace translator
-
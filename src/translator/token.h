@@ -7,6 +7,7 @@
  */
 #pragma once
 #include <string>
+#include <string_view>
 
 namespace translator {
 
@@ -25,6 +26,7 @@ enum class TokenType {
     KW_GOTO,      ///< GOTO anahtar sözcüğü
     KW_FOR,       ///< FOR anahtar sözcüğü
     KW_TO,        ///< TO anahtar sözcüğü
+    KW_STEP,      ///< STEP anahtar sözcüğü
     KW_NEXT,      ///< NEXT anahtar sözcüğü
     KW_GOSUB,     ///< GOSUB anahtar sözcüğü
     KW_RETURN,    ///< RETURN anahtar sözcüğü
@@ -32,7 +34,12 @@ enum class TokenType {
     Minus,        ///< '-'
     Star,         ///< '*'
     Slash,        ///< '/'
-    Assign,       ///< '='
+    Assign,       ///< '=' (atama; ifade içinde eşitlik)
+    Less,         ///< '<'
+    Greater,      ///< '>'
+    LessEqual,    ///< '<='
+    GreaterEqual, ///< '>='
+    NotEqual,     ///< '<>'
     LParen,       ///< '('
     RParen,       ///< ')'
     Comma,        ///< ','
@@ -43,12 +50,27 @@ enum class TokenType {
 /**
  * @brief Belirteç kaydı
  * 
- * Her belirteç, türü, metni ve satır numarasını içerir.
+ * Her belirteç, türü, metni, satır ve sütun numarasını içerir.
  */
 struct Token { 
     TokenType type;      ///< Belirteç türü
     std::string lexeme;  ///< Belirteç metni
     int line;            ///< Satır numarası
+    int column = 0;      ///< 1 tabanlı sütun; 0 ise bilinmiyor
+};
+
+/**
+ * @brief Kaynak tampona işaret eden kopyasız belirteç
+ * 
+ * Token ile aynı alanlara sahiptir; ancak lexeme, Lexer'ın kaynak
+ * tamponundaki ilgili aralığa bir görünümdür ve hiçbir bellek ayırmaz.
+ * Görünüm, onu üreten kaynak yaşadığı sürece geçerlidir.
+ */
+struct TokenView {
+    TokenType type;            ///< Belirteç türü
+    std::string_view lexeme;   ///< Kaynak tampondaki belirteç metni
+    int line;                  ///< Satır numarası
+    int column = 0;            ///< 1 tabanlı sütun; 0 ise bilinmiyor
 };
 
 } // namespace translator
@@ -0,0 +1,272 @@
+/**
+ * @file types.cpp
+ * @brief Tamsayı / double tür çıkarımı: double kaynaklarından ileri yayılım.
+ */
+#include "translator/types.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace translator {
+
+namespace {
+
+constexpr double kExact = 9007199254740992.0;   // 2^53: double'ın her tamsayıyı tam gösterdiği sınır
+constexpr double kUnknown = std::numeric_limits<double>::infinity();
+
+/** \brief Sabit, tamsayı türünde aynı değerle gösterilebilir mi? (-0 gösterilemez) */
+bool integral(double v){
+    return std::trunc(v) == v && std::fabs(v) < kExact && !(v == 0 && std::signbit(v));
+}
+
+/** \brief İşlem, işlenenlerinin türünü ve büyüklüğünü sonuca taşır mı? */
+bool arithmetic(char op){ return op == '+' || op == '-' || op == '*'; }
+
+/** \brief Düğüm sıfırdan büyük bir sabit mi? */
+bool positive_literal(const FlatProgram& p, NodeIndex e){
+    return p.expr_kind[e] == ExprKind::Number && p.numbers[p.expr_a[e]] > 0;
+}
+
+/**
+ * \brief Bir ifadenin büyüklüğünü belirleyen değişken okumaları.
+ *
+ * Karşılaştırmalar 0/1 verdiğinden altlarına inilmez. Açık yığınla
+ * gezilir; derin ifadeler çağrı yığınını tüketmez.
+ */
+void collect_reads(const FlatProgram& p, NodeIndex root, std::vector<NodeIndex>& out, std::vector<NodeIndex>& stack){
+    stack.assign(1, root);
+    while (!stack.empty()){
+        const NodeIndex e = stack.back(); stack.pop_back();
+        switch (p.expr_kind[e]){
+            case ExprKind::Number: break;
+            case ExprKind::Variable: out.push_back(p.expr_a[e]); break;
+            case ExprKind::Binary:
+                if (arithmetic(p.expr_op[e]) || p.expr_op[e] == '/'){ stack.push_back(p.expr_a[e]); stack.push_back(p.expr_b[e]); }
+                break;
+        }
+    }
+}
+
+/**
+ * \brief FOR döngüsü kapalı mı: gövdesine ve NEXT'ine yalnızca döngünün içinden atlanır ve gövde GOSUB içermez?
+ * \param p Düz program
+ * \param first_src Deyime atlayan ilk deyim (yoksa deyim sayısı)
+ * \param last_src Deyime atlayan son deyim (yoksa -1)
+ * \param i FOR deyiminin indeksi
+ *
+ * Kapalı döngüde NEXT yalnızca FOR'dan sonra, sayaç sınırı aşana dek
+ * çalışır; RETURN da ancak gövdedeki bir GOSUB'tan sonra gövdeye döner.
+ */
+bool closed_loop(const FlatProgram& p, const std::vector<int>& first_src, const std::vector<int>& last_src, int i){
+    const int n = static_cast<int>(p.size());
+    const int t = p.stmt_a[i] < 0 ? LabelIndex::npos : p.index.find(p.stmt_a[i]);
+    const int x = t != LabelIndex::npos ? t - 1 : p.stmt_a[i] < 0 ? n - 1 : -1;
+    if (x <= i || p.stmt_kind[x] != StmtKind::Next || p.index.find(p.stmt_a[x]) != i + 1) return false;
+    for (int j = i + 1; j <= x; ++j){
+        if (first_src[j] < i || last_src[j] > x || p.stmt_kind[j] == StmtKind::Gosub) return false;
+    }
+    return true;
+}
+
+/**
+ * \brief Değişken bağımlılık grafiğinin güçlü bağlı bileşenleri (yinelemeli Tarjan).
+ * \param adj u → v: v'nin değeri u'ya bağlı
+ * \param[out] order Bileşenler, her bileşen bağımlı olduklarından sonra gelecek sırada
+ * \return Değişken başına bileşen numarası
+ */
+std::vector<int> components(const std::vector<std::vector<NodeIndex>>& adj, std::vector<std::vector<NodeIndex>>& order){
+    const std::size_t n = adj.size();
+    std::vector<int> index(n, -1), low(n, 0), comp(n, -1);
+    std::vector<NodeIndex> stack;
+    std::vector<std::pair<NodeIndex, std::size_t>> call;   // (düğüm, sıradaki kenar)
+    int next = 0;
+    for (std::size_t s = 0; s < n; ++s){
+        if (index[s] >= 0) continue;
+        call.push_back({static_cast<NodeIndex>(s), 0});
+        index[s] = low[s] = next++; stack.push_back(static_cast<NodeIndex>(s));
+        while (!call.empty()){
+            auto& [v, k] = call.back();
+            if (k < adj[v].size()){
+                const NodeIndex w = adj[v][k++];
+                if (index[w] < 0){
+                    index[w] = low[w] = next++; stack.push_back(w);
+                    call.push_back({w, 0});
+                } else if (comp[w] < 0) low[v] = std::min(low[v], index[w]);
+                continue;
+            }
+            const NodeIndex done = v;
+            call.pop_back();
+            if (!call.empty()) low[call.back().first] = std::min(low[call.back().first], low[done]);
+            if (low[done] != index[done]) continue;
+            order.emplace_back();
+            NodeIndex w;
+            do { w = stack.back(); stack.pop_back(); comp[w] = static_cast<int>(order.size() - 1); order.back().push_back(w); } while (w != done);
+        }
+    }
+    // Tarjan bileşenleri bağımlılarından önce bitirir; ters çevrilince bağımlılıklar öne gelir.
+    std::reverse(order.begin(), order.end());
+    for (int& c : comp) c = static_cast<int>(order.size()) - 1 - c;
+    return comp;
+}
+
+} // namespace
+
+/**
+ * \brief Değişken ve ifade türlerini çıkarır.
+ * \param p Düz program
+ * \return Türler
+ *
+ * Önce `double` kaynakları bulunur: kesirli sabitler, `/`, INPUT, pozitif
+ * sabitle çarpılmayan `*` (-0 üretebilir) ve büyüklük sınırı 2^53'e ulaşan
+ * ya da bilinmeyen (sayaç olmayan döngüdeki) ifadeler ve değişkenler. Sonra kenarlar boyunca yayılır: değişken → onu okuyan
+ * düğüm, aritmetik işlenen → ebeveyni, LET'in kök ifadesi ile FOR'un
+ * başlangıç ve adım ifadeleri → hedef değişken. İş listesi her düğümü en
+ * fazla bir kez işaretler.
+ */
+TypeInfo infer_types(const FlatProgram& p){
+    if (!p.index.matches(p.labels)){
+        FlatProgram fixed = p;
+        fixed.index = LabelIndex(fixed.labels);
+        return infer_types(fixed);
+    }
+    const std::size_t ne = p.expr_kind.size(), nv = p.names.size();
+    TypeInfo t;
+    t.vars.assign(nv, ValueType::Int);
+    t.exprs.assign(ne, ValueType::Int);
+
+    struct Out { NodeIndex parent = -1, assigns = -1; };   // düğümden çıkan kenarlar
+    std::vector<Out> out(ne);
+    std::vector<std::vector<NodeIndex>> readers(nv);
+    std::vector<NodeIndex> work;   // iş listesi: ifade e için e, değişken v için ~v
+    auto mark_expr = [&](NodeIndex e){ if (t.exprs[e] == ValueType::Int){ t.exprs[e] = ValueType::Double; work.push_back(e); } };
+    auto mark_var = [&](NodeIndex v){ if (t.vars[v] == ValueType::Int){ t.vars[v] = ValueType::Double; work.push_back(~v); } };
+
+    for (std::size_t i = 0; i < ne; ++i){
+        const NodeIndex e = static_cast<NodeIndex>(i), a = p.expr_a[i], b = p.expr_b[i];
+        switch (p.expr_kind[i]){
+            case ExprKind::Number: if (!integral(p.numbers[a])) mark_expr(e); break;
+            case ExprKind::Variable: readers[a].push_back(e); break;
+            case ExprKind::Binary:
+                if (p.expr_op[i] == '/') mark_expr(e);
+                else if (arithmetic(p.expr_op[i])){
+                    out[a].parent = out[b].parent = e;
+                    // Negatif × 0 = -0; tamsayıda -0 yoktur. Pozitif sabit çarpan işareti korur.
+                    if (p.expr_op[i] == '*' && !positive_literal(p, a) && !positive_literal(p, b)) mark_expr(e);
+                }
+                break;
+        }
+    }
+
+    // Atamalar: (kök ifade, hedef, atayan FOR ya da -1). NEXT'in `v += adım`ı FOR'un adım atamasıdır.
+    struct Assign { NodeIndex root, var; int loop; };
+    std::vector<Assign> assigns;
+    const int n = static_cast<int>(p.size());
+    std::vector<int> first_src(n, n), last_src(n, -1);   // deyime atlayan ilk ve son deyim
+    for (int i = 0; i < n; ++i){
+        const StmtKind k = p.stmt_kind[i];
+        if (k == StmtKind::Let){
+            out[p.stmt_b[i]].assigns = p.stmt_a[i];
+            assigns.push_back({p.stmt_b[i], p.stmt_a[i], -1});
+        } else if (k == StmtKind::Input) mark_var(p.stmt_a[i]);
+        else if (k == StmtKind::For){
+            // FOR değişkene başlangıcı atar, NEXT ona adımı ekler; sınır yalnızca karşılaştırılır.
+            const NodeIndex* it = &p.items[p.stmt_b[i]];
+            const NodeIndex v = p.expr_a[it[0]];
+            out[it[1]].assigns = out[it[3]].assigns = v;
+            assigns.push_back({it[1], v, i});
+            assigns.push_back({it[3], v, i});
+        }
+        if (k == StmtKind::Goto || k == StmtKind::IfGoto || k == StmtKind::Gosub || k == StmtKind::For || k == StmtKind::Next){
+            const int t = p.stmt_a[i] < 0 ? LabelIndex::npos : p.index.find(p.stmt_a[i]);
+            if (t != LabelIndex::npos){ first_src[t] = std::min(first_src[t], i); last_src[t] = std::max(last_src[t], i); }
+        }
+    }
+
+    // Bağımlılık grafiği: okunan değişken → atanan değişken. FOR'un sınırı da sayacın
+    // büyüklüğünü belirler; NEXT adımı sayacın kendisine ekler.
+    std::vector<std::vector<NodeIndex>> adj(nv);
+    std::vector<NodeIndex> reads, scratch;
+    for (const Assign& as : assigns){
+        reads.clear();
+        collect_reads(p, as.root, reads, scratch);
+        if (as.loop >= 0 && as.root == p.items[p.stmt_b[as.loop] + 3]){
+            collect_reads(p, p.items[p.stmt_b[as.loop] + 2], reads, scratch);
+            reads.push_back(as.var);
+        }
+        for (NodeIndex r : reads) adj[r].push_back(as.var);
+    }
+    std::vector<std::vector<NodeIndex>> order;
+    const std::vector<int> comp = components(adj, order);
+
+    // Sayaç: yalnızca kapalı FOR'larca atanan ve başlangıç, sınır ya da adımında kendini
+    // okumayan değişken. Değeri girişteki |başlangıç| ile |sınır| + |adım| arasında kalır.
+    std::vector<unsigned char> counter(nv, 1);
+    for (const Assign& as : assigns){
+        if (as.loop < 0 || !closed_loop(p, first_src, last_src, as.loop)){ counter[as.var] = 0; continue; }
+        reads.clear();
+        for (int k = 1; k <= 3; ++k) collect_reads(p, p.items[p.stmt_b[as.loop] + k], reads, scratch);
+        if (std::find(reads.begin(), reads.end(), as.var) != reads.end()) counter[as.var] = 0;
+    }
+
+    // Büyüklük sınırları bağımlılıklardan önce hesaplanır. Döngüdeki değişkenin sınırı
+    // sayaç değilse bilinmez: kendine eklenen her değer 2^53'ü ve 2^63'ü aşabilir.
+    std::vector<double> vbound(nv, 0.0), nbound(ne, -1.0);
+    // INPUT her değeri okuyabilir; aşağıdaki en büyük alma bunu korur.
+    for (int i = 0; i < n; ++i) if (p.stmt_kind[i] == StmtKind::Input) vbound[p.stmt_a[i]] = kUnknown;
+    std::vector<std::vector<std::size_t>> assigned(nv);
+    for (std::size_t k = 0; k < assigns.size(); ++k) assigned[assigns[k].var].push_back(k);
+    std::vector<NodeIndex> stack;
+    auto bound_of = [&](NodeIndex root){
+        // Alt-önce değerlendirme: çocukları hesaplanmamış düğüm yığında iki kez görülür.
+        stack.assign(1, root);
+        while (!stack.empty()){
+            const NodeIndex e = stack.back();
+            if (nbound[e] >= 0){ stack.pop_back(); continue; }
+            const NodeIndex a = p.expr_a[e], b = p.expr_b[e];
+            const char op = p.expr_op[e];
+            switch (p.expr_kind[e]){
+                case ExprKind::Number: nbound[e] = std::fabs(p.numbers[a]); break;
+                case ExprKind::Variable: nbound[e] = vbound[a]; break;
+                case ExprKind::Binary:
+                    if (!arithmetic(op) && op != '/'){ nbound[e] = 1.0; break; }   // karşılaştırma
+                    if (op == '/' && !(p.expr_kind[b] == ExprKind::Number && std::fabs(p.numbers[p.expr_a[b]]) >= 1)){ nbound[e] = kUnknown; break; }
+                    if (nbound[a] < 0 || nbound[b] < 0){ if (nbound[a] < 0) stack.push_back(a); if (nbound[b] < 0) stack.push_back(b); continue; }
+                    nbound[e] = op == '*' ? nbound[a] * nbound[b] : op == '/' ? nbound[a] : nbound[a] + nbound[b];
+                    if (std::isnan(nbound[e])) nbound[e] = kUnknown;   // 0 × bilinmez
+                    break;
+            }
+            stack.pop_back();
+        }
+        return nbound[root];
+    };
+    for (std::size_t c = 0; c < order.size(); ++c){
+        const bool single = order[c].size() == 1 && std::find(adj[order[c][0]].begin(), adj[order[c][0]].end(), order[c][0]) == adj[order[c][0]].end();
+        for (NodeIndex v : order[c]){
+            if (single){
+                for (std::size_t k : assigned[v]) vbound[v] = std::max(vbound[v], bound_of(assigns[k].root));
+            } else if (order[c].size() == 1 && counter[v]){
+                for (std::size_t k : assigned[v]){
+                    const NodeIndex* it = &p.items[p.stmt_b[assigns[k].loop]];
+                    vbound[v] = std::max({vbound[v], bound_of(it[1]), bound_of(it[2]) + bound_of(it[3])});
+                }
+            } else vbound[v] = kUnknown;
+            if (vbound[v] >= kExact) mark_var(v);
+        }
+    }
+    for (std::size_t i = 0; i < ne; ++i){
+        if (bound_of(static_cast<NodeIndex>(i)) >= kExact) mark_expr(static_cast<NodeIndex>(i));
+    }
+
+    while (!work.empty()){
+        const NodeIndex n = work.back(); work.pop_back();
+        if (n < 0){
+            for (NodeIndex e : readers[~n]) mark_expr(e);
+        } else {
+            if (out[n].parent >= 0) mark_expr(out[n].parent);
+            if (out[n].assigns >= 0) mark_var(out[n].assigns);
+        }
+    }
+    return t;
+}
+
+} // namespace translator
@@ -0,0 +1,66 @@
+/**
+ * @file types.h
+ * @brief Düz AST üzerinde değişken ve ifade türü çıkarımı (tamsayı / double)
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "translator/flat_ast.h"
+
+namespace translator {
+
+/**
+ * @brief Bir değerin üretilen koddaki gösterimi
+ */
+enum class ValueType : unsigned char {
+    Int,     ///< Her zaman tamsayı; `std::int64_t`
+    Double   ///< Kesirli olabilir; `double`
+};
+
+/**
+ * @brief infer_types() sonucu
+ */
+struct TypeInfo {
+    std::vector<ValueType> vars;    ///< Değişken kimliği başına tür
+    std::vector<ValueType> exprs;   ///< İfade düğümü başına tür
+
+    /** @brief Tamsayı kalan değişken sayısı. */
+    std::size_t int_vars() const noexcept {
+        std::size_t n = 0;
+        for (ValueType t : vars) n += t == ValueType::Int;
+        return n;
+    }
+};
+
+/**
+ * @brief Hangi değişkenlerin programın her yolunda tamsayı kaldığını bulur
+ * @param p Düz program; ifadeler alt-önce sırada olmalıdır
+ * @return Değişken ve ifade türleri
+ *
+ * Her şey önce tamsayı kabul edilir; `double` olabilecek kaynaklardan
+ * geriye doğru yayılım yapılır. Tamsayı kalan her ifade `double`
+ * anlamıyla aynı değeri üretir:
+ * - Kesirli, -0 ya da 2^53'ten büyük sabitler, `/` işlemi ve INPUT
+ *   hedefleri `double`'dır.
+ * - Pozitif bir sabitle çarpılmayan `*` `double`'dır: negatif × 0 `-0`
+ *   verir, tamsayıda ise -0 yoktur.
+ * - Her ifade ve değişken için bir büyüklük sınırı hesaplanır; sınırı
+ *   2^53'e ulaşan ya da bilinmeyen `double`'dır. Bağımlılık grafiğinde
+ *   bir döngüde kalan (kendi değerinden hesaplanan) değişkenin sınırı
+ *   bilinmez. Tek istisna sayaçtır: yalnızca gövdesine dışarıdan
+ *   atlanmayan ve GOSUB içermeyen FOR döngülerince atanan değişken,
+ *   girişteki |başlangıç| ve |sınır| + |adım| ile sınırlıdır.
+ * - `+ - *` işlenenlerinden biri `double` ise sonuç da `double`'dır;
+ *   karşılaştırmalar her zaman tamsayıdır (0/1).
+ * - `double` bir ifadeyi LET ile alan değişken ve onu okuyan her ifade
+ *   `double` olur; FOR'un başlangıcı ya da adımı `double` ise döngü
+ *   değişkeni de öyledir.
+ *
+ * Atanmamış değişkenler 0 ile başladığından tamsayıdır.
+ */
+TypeInfo infer_types(const FlatProgram& p);
+
+} // namespace translator
@@ -0,0 +1,287 @@
+/**
+ * @file vm.cpp
+ * @brief Bayt kodu derleyicisi ve yorumlayıcısının uygulaması.
+ */
+#include "translator/vm.h"
+#include <algorithm>
+#include <istream>
+#include <unordered_map>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__GNUC__)
+#define TRANSLATOR_VM_THREADED 1
+#else
+#define TRANSLATOR_VM_THREADED 0
+#endif
+
+namespace translator {
+
+namespace {
+
+/**
+ * \brief Düz programı tek geçişte bayt koduna çevirir.
+ *
+ * Atlama komutlarına önce hedef etiket yazılır; tüm deyimler yerleşince
+ * etiketler komut indekslerine çözülür.
+ */
+class Compiler {
+    const FlatProgram& p_;
+    Bytecode& bc_;
+    std::size_t depth_ = 0;
+    std::vector<std::size_t> jumps_;   ///< Hedefi etiket olarak duran komutlar
+    std::unordered_map<int, std::int32_t> loop_ids_;  ///< Gövde etiketi → loops indeksi
+    std::vector<int> exits_;           ///< loops başına çıkış etiketi (FOR görülmediyse -1)
+    std::vector<std::pair<NodeIndex, bool>> todo_;   ///< expr(): (düğüm, işlenenleri yazıldı mı)
+
+    void emit(OpCode op, std::int32_t arg = 0){ bc_.code.push_back({op, arg}); }
+
+    /**
+     * \brief Gövde etiketiyle tanınan döngünün kaydını bulur ya da açar.
+     * \param body Gövde etiketi
+     * \param var Döngü değişkeni
+     */
+    std::int32_t loop(int body, NodeIndex var){
+        auto it = loop_ids_.find(body);
+        if (it != loop_ids_.end()) return it->second;
+        const std::int32_t k = static_cast<std::int32_t>(bc_.loops.size());
+        const std::int32_t bound = static_cast<std::int32_t>(bc_.names.size());
+        bc_.names.push_back("to " + std::to_string(body));
+        bc_.names.push_back("step " + std::to_string(body));
+        // Gövde ve çıkış etiketleri tüm deyimler yerleşince komut indekslerine çözülür.
+        bc_.loops.push_back({var, bound, body, -1});
+        exits_.push_back(-1);
+        loop_ids_.emplace(body, k);
+        return k;
+    }
+    void push(){ if (++depth_ > bc_.max_stack) bc_.max_stack = depth_; }
+
+    /** \brief İfadeyi yığın makinesi komutlarına çevirir; ağaç açık yığınla alt-önce gezilir. */
+    void expr(NodeIndex e){
+        todo_.assign(1, {e, false});
+        while (!todo_.empty()){
+            auto [x, expanded] = todo_.back(); todo_.pop_back();
+            switch (p_.expr_kind[x]){
+                case ExprKind::Number: emit(OpCode::Const, p_.expr_a[x]); push(); continue;
+                case ExprKind::Variable: emit(OpCode::Load, p_.expr_a[x]); push(); continue;
+                case ExprKind::Binary: break;
+            }
+            if (!expanded){
+                todo_.push_back({x, true}); todo_.push_back({p_.expr_b[x], false}); todo_.push_back({p_.expr_a[x], false});
+                continue;
+            }
+            switch (p_.expr_op[x]){
+                case '+': emit(OpCode::Add); break;
+                case '-': emit(OpCode::Sub); break;
+                case '*': emit(OpCode::Mul); break;
+                case '/': emit(OpCode::Div); break;
+                case '<': emit(OpCode::Less); break;
+                case '>': emit(OpCode::Greater); break;
+                case 'L': emit(OpCode::LessEq); break;
+                case 'G': emit(OpCode::GreaterEq); break;
+                case '=': emit(OpCode::Equal); break;
+                case 'N': emit(OpCode::NotEqual); break;
+                default: throw std::runtime_error(std::string("Bytecode: unsupported operator '") + p_.expr_op[x] + "'");
+            }
+            --depth_;
+        }
+    }
+
+    void jump(OpCode op, int label){ jumps_.push_back(bc_.code.size()); emit(op, label); }
+
+public:
+    Compiler(const FlatProgram& p, Bytecode& bc): p_(p), bc_(bc) {}
+
+    void run(){
+        bc_.consts = p_.numbers;
+        bc_.names = p_.names;
+        bc_.stmt_pc.reserve(p_.size());
+        bc_.code.reserve(p_.size() * 3 + p_.expr_kind.size() + p_.items.size() + 1);
+        for (std::size_t i=0;i<p_.size();++i){
+            bc_.stmt_pc.push_back(static_cast<std::int32_t>(bc_.code.size()));
+            const NodeIndex a = p_.stmt_a[i], b = p_.stmt_b[i];
+            switch (p_.stmt_kind[i]){
+                case StmtKind::Let: expr(b); emit(OpCode::Store, a); --depth_; break;
+                case StmtKind::Print:
+                    for (NodeIndex k=0;k<b;++k){ expr(p_.items[a + k]); emit(OpCode::Print); --depth_; }
+                    emit(OpCode::PrintEnd);
+                    break;
+                case StmtKind::Input: emit(OpCode::Input, a); break;
+                case StmtKind::Goto: jump(OpCode::Jump, a); break;
+                case StmtKind::IfGoto: expr(b); jump(OpCode::JumpIf, a); --depth_; break;
+                // Son deyimdeki GOSUB'un dönüş noktası yoktur; üretilen kod gibi programı bitirir.
+                case StmtKind::Gosub: if (i + 1 < p_.size()) jump(OpCode::Gosub, a); else emit(OpCode::Halt); break;
+                case StmtKind::Return: emit(OpCode::Return); break;
+                case StmtKind::For: {
+                    // Sınır ve adım başlangıçtan önce hesaplanır; FOR'u her zaman en az bir deyim izler.
+                    const std::int32_t k = loop(i + 1 < p_.size() ? p_.labels[i + 1] : -1, p_.expr_a[p_.items[b]]);
+                    expr(p_.items[b + 2]); emit(OpCode::Store, bc_.loops[k].bound); --depth_;
+                    expr(p_.items[b + 3]); emit(OpCode::Store, bc_.loops[k].bound + 1); --depth_;
+                    expr(p_.items[b + 1]); emit(OpCode::Store, bc_.loops[k].var); --depth_;
+                    exits_[k] = a;
+                    emit(OpCode::ForEnter, k);
+                    break;
+                }
+                case StmtKind::Next: emit(OpCode::ForNext, loop(a, b)); break;
+            }
+        }
+        const std::int32_t halt = static_cast<std::int32_t>(bc_.code.size());
+        emit(OpCode::Halt);
+
+        auto resolve = [&](int label){
+            const int t = p_.index.find(label);
+            return t != LabelIndex::npos ? bc_.stmt_pc[t] : halt;
+        };
+        for (std::size_t j : jumps_) bc_.code[j].arg = resolve(bc_.code[j].arg);
+        for (std::size_t k=0;k<bc_.loops.size();++k){
+            bc_.loops[k].body = resolve(bc_.loops[k].body);
+            bc_.loops[k].exit = resolve(exits_[k]);
+        }
+    }
+};
+
+const char* const kOpNames[] = {
+    "Const", "Load", "Add", "Sub", "Mul", "Div", "Less", "Greater", "LessEq", "GreaterEq",
+    "Equal", "NotEqual", "Store", "Print", "PrintEnd",
+    "Input", "Jump", "JumpIf", "Gosub", "Return", "ForEnter", "ForNext", "Halt"
+};
+
+} // namespace
+
+/**
+ * \brief Düz programı bayt koduna çevirir.
+ * \param p Düz program
+ * \return Derlenmiş program
+ */
+Bytecode compile_bytecode(const FlatProgram& p){
+    if (!p.index.matches(p.labels)){
+        FlatProgram fixed = p;
+        fixed.index = LabelIndex(fixed.labels);
+        return compile_bytecode(fixed);
+    }
+    Bytecode bc;
+    Compiler(p, bc).run();
+    return bc;
+}
+
+/**
+ * \brief Program'ı düzleştirip bayt koduna çevirir.
+ * \param p Program
+ * \return Derlenmiş program
+ */
+Bytecode compile_bytecode(const Program& p){
+    return compile_bytecode(flatten(p));
+}
+
+/**
+ * \brief Bayt kodunu listeler.
+ * \param bc Derlenmiş program
+ * \return Satır başına `indeks işlem [arg]` ve gerekirse açıklama
+ */
+std::string disassemble(const Bytecode& bc){
+    std::ostringstream os;
+    for (std::size_t i=0;i<bc.code.size();++i){
+        const Instr& in = bc.code[i];
+        os << i << ": " << kOpNames[static_cast<int>(in.op)];
+        switch (in.op){
+            case OpCode::Const: os << ' ' << in.arg << "  ; " << bc.consts[in.arg]; break;
+            case OpCode::Load: case OpCode::Store: case OpCode::Input: os << ' ' << in.arg << "  ; " << bc.names[in.arg]; break;
+            case OpCode::Jump: case OpCode::JumpIf: case OpCode::Gosub: os << ' ' << in.arg; break;
+            case OpCode::ForEnter: case OpCode::ForNext: {
+                const LoopInfo& l = bc.loops[in.arg];
+                os << ' ' << in.arg << "  ; " << bc.names[l.var] << " body " << l.body << " exit " << l.exit;
+                break;
+            }
+            default: break;
+        }
+        os << '\n';
+    }
+    return os.str();
+}
+
+/**
+ * \brief Programı çalıştırmaya hazırlar.
+ * \param bc Derlenmiş program
+ */
+VM::VM(const Bytecode& bc): bc_(bc), vars_(bc.names.size(), 0.0), stack_(bc.max_stack + 1) {}
+
+/**
+ * \brief Programı çalıştırır.
+ * \param in INPUT kaynağı
+ * \param out PRINT hedefi
+ * \return Çalıştırılan komut sayısı
+ */
+std::uint64_t VM::run(std::istream& in, std::ostream& out){
+    std::fill(vars_.begin(), vars_.end(), 0.0);
+    calls_.clear();
+    const Instr* const code = bc_.code.data();
+    const double* const consts = bc_.consts.data();
+    const LoopInfo* const loops = bc_.loops.data();
+    double* const vars = vars_.data();
+    double* sp = stack_.data();   // ilk boş yuva
+    const Instr* ip = code;
+    std::uint64_t steps = 0;
+
+#if TRANSLATOR_VM_THREADED
+    // Sıra OpCode ile aynı olmalıdır.
+    static const void* const table[] = {
+        &&op_Const, &&op_Load, &&op_Add, &&op_Sub, &&op_Mul, &&op_Div, &&op_Less, &&op_Greater,
+        &&op_LessEq, &&op_GreaterEq, &&op_Equal, &&op_NotEqual, &&op_Store, &&op_Print,
+        &&op_PrintEnd, &&op_Input, &&op_Jump, &&op_JumpIf, &&op_Gosub, &&op_Return, &&op_ForEnter,
+        &&op_ForNext, &&op_Halt
+    };
+#define VM_CASE(name) op_##name:
+#define VM_NEXT() do { ++steps; goto *table[static_cast<int>(ip->op)]; } while (0)
+    VM_NEXT();
+#else
+#define VM_CASE(name) case OpCode::name:
+#define VM_NEXT() break
+    for (;;) { ++steps; switch (ip->op) {
+#endif
+    VM_CASE(Const) *sp++ = consts[ip->arg]; ++ip; VM_NEXT();
+    VM_CASE(Load) *sp++ = vars[ip->arg]; ++ip; VM_NEXT();
+    VM_CASE(Add) --sp; sp[-1] += sp[0]; ++ip; VM_NEXT();
+    VM_CASE(Sub) --sp; sp[-1] -= sp[0]; ++ip; VM_NEXT();
+    VM_CASE(Mul) --sp; sp[-1] *= sp[0]; ++ip; VM_NEXT();
+    VM_CASE(Div) --sp; sp[-1] /= sp[0]; ++ip; VM_NEXT();
+    VM_CASE(Less) --sp; sp[-1] = sp[-1] < sp[0]; ++ip; VM_NEXT();
+    VM_CASE(Greater) --sp; sp[-1] = sp[-1] > sp[0]; ++ip; VM_NEXT();
+    VM_CASE(LessEq) --sp; sp[-1] = sp[-1] <= sp[0]; ++ip; VM_NEXT();
+    VM_CASE(GreaterEq) --sp; sp[-1] = sp[-1] >= sp[0]; ++ip; VM_NEXT();
+    VM_CASE(Equal) --sp; sp[-1] = sp[-1] == sp[0]; ++ip; VM_NEXT();
+    VM_CASE(NotEqual) --sp; sp[-1] = sp[-1] != sp[0]; ++ip; VM_NEXT();
+    VM_CASE(Store) vars[ip->arg] = *--sp; ++ip; VM_NEXT();
+    VM_CASE(Print) out << *--sp; ++ip; VM_NEXT();
+    VM_CASE(PrintEnd) out << '\n'; ++ip; VM_NEXT();
+    VM_CASE(Input) { double tmp = 0; in >> tmp; vars[ip->arg] = tmp; ++ip; VM_NEXT(); }
+    VM_CASE(Jump) ip = code + ip->arg; VM_NEXT();
+    VM_CASE(JumpIf) ip = *--sp ? code + ip->arg : ip + 1; VM_NEXT();
+    VM_CASE(Gosub) calls_.push_back(static_cast<std::int32_t>(ip - code) + 1); ip = code + ip->arg; VM_NEXT();
+    VM_CASE(Return)
+        if (calls_.empty()) goto halt;
+        ip = code + calls_.back(); calls_.pop_back(); VM_NEXT();
+    VM_CASE(ForEnter) {
+        const LoopInfo& l = loops[ip->arg];
+        const double v = vars[l.var], to = vars[l.bound], step = vars[l.bound + 1];
+        ip = (step >= 0 ? v <= to : v >= to) ? ip + 1 : code + l.exit; VM_NEXT();
+    }
+    VM_CASE(ForNext) {
+        const LoopInfo& l = loops[ip->arg];
+        const double to = vars[l.bound], step = vars[l.bound + 1];
+        const double v = vars[l.var] += step;
+        ip = (step >= 0 ? v <= to : v >= to) ? code + l.body : ip + 1; VM_NEXT();
+    }
+    VM_CASE(Halt) goto halt;
+#if !TRANSLATOR_VM_THREADED
+    } }
+#endif
+#undef VM_CASE
+#undef VM_NEXT
+halt:
+    out.flush();
+    return steps;
+}
+
+} // namespace translator
@@ -0,0 +1,143 @@
+/**
+ * @file vm.h
+ * @brief Programları C++ derlemesi olmadan çalıştıran bayt kodu ve yorumlayıcı
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "translator/ast.h"
+#include "translator/flat_ast.h"
+
+namespace translator {
+
+/**
+ * @brief Yığın tabanlı makinenin işlem kodları
+ */
+enum class OpCode : std::uint8_t {
+    Const,      ///< consts[arg] yığına
+    Load,       ///< vars[arg] yığına
+    Add,        ///< İki değeri alır, toplamı yığına
+    Sub,        ///< İki değeri alır, farkı yığına
+    Mul,        ///< İki değeri alır, çarpımı yığına
+    Div,        ///< İki değeri alır, bölümü yığına
+    Less,       ///< İki değeri alır, a < b ise 1, değilse 0 yığına
+    Greater,    ///< a > b
+    LessEq,     ///< a <= b
+    GreaterEq,  ///< a >= b
+    Equal,      ///< a == b
+    NotEqual,   ///< a != b
+    Store,      ///< Tepeyi alıp vars[arg]'a yazar
+    Print,      ///< Tepeyi alıp yazar
+    PrintEnd,   ///< Satır sonu yazar
+    Input,      ///< Bir sayı okuyup vars[arg]'a yazar
+    Jump,       ///< arg komutuna atlar
+    JumpIf,     ///< Tepeyi alır; sıfır değilse arg komutuna atlar
+    Gosub,      ///< Sonraki komutu çağrı yığınına koyup arg komutuna atlar
+    Return,     ///< Çağrı yığını boşsa durur, değilse oradan döner
+    ForEnter,   ///< loops[arg]: ForNext'in gövdeye dönme koşulu tutmuyorsa çıkışa atlar
+    ForNext,    ///< loops[arg]: değişkene adımı ekler, sınırı aşmadıysa gövdeye atlar
+    Halt        ///< Çalışmayı bitirir
+};
+
+/**
+ * @brief Tek bir komut (8 bayt)
+ */
+struct Instr {
+    OpCode op;          ///< İşlem kodu
+    std::int32_t arg;   ///< Sabit/değişken indeksi ya da atlama hedefi
+};
+
+/**
+ * @brief Bir FOR döngüsünün ForEnter / ForNext komutlarının işlenenleri
+ *
+ * Sınır ve adım `vars` içinde, program değişkenlerinden sonra ayrılan
+ * `bound` ve `bound + 1` yuvalarında tutulur.
+ */
+struct LoopInfo {
+    std::int32_t var;     ///< Döngü değişkeninin yuvası
+    std::int32_t bound;   ///< Sınırın yuvası; adım bir sonrakindedir
+    std::int32_t body;    ///< Gövdenin ilk komutu
+    std::int32_t exit;    ///< Döngüden sonraki ilk komut
+};
+
+/**
+ * @brief Derlenmiş program
+ */
+struct Bytecode {
+    std::vector<Instr> code;           ///< Komutlar; son komut her zaman Halt
+    std::vector<double> consts;        ///< Sabit havuzu
+    std::vector<std::string> names;    ///< Değişken adları (Store/Load/Input indeksleri); FOR yuvaları `to <gövde>` ve `step <gövde>`
+    std::vector<LoopInfo> loops;       ///< ForEnter / ForNext işlenenleri
+    std::vector<std::int32_t> stmt_pc; ///< Deyim başına ilk komut indeksi
+    std::size_t max_stack = 0;         ///< Gereken en büyük işlenen yığını derinliği
+};
+
+/**
+ * @brief Düz programı bayt koduna çevirir
+ * @param p Düz program
+ * @return Derlenmiş program
+ * @throws std::runtime_error Bilinmeyen bir ikili operatör varsa
+ *
+ * Üretilen kodun anlamı Codegen::emit_cpp çıktısıyla aynıdır: değişkenler
+ * 0 ile başlar, olmayan etikete atlama ve son deyimdeki GOSUB programı
+ * bitirir, boş çağrı yığınında RETURN programı bitirir. FOR sınırı ve
+ * adımı döngü başına ayrılan gizli yuvalarda (`to L`, `step L`) tutulur.
+ */
+Bytecode compile_bytecode(const FlatProgram& p);
+
+/**
+ * @brief Program'ı düzleştirip bayt koduna çevirir
+ * @param p Program
+ * @return Derlenmiş program
+ */
+Bytecode compile_bytecode(const Program& p);
+
+/**
+ * @brief Bayt kodunu okunur biçimde listeler
+ * @param bc Derlenmiş program
+ * @return Satır başına bir komut
+ */
+std::string disassemble(const Bytecode& bc);
+
+/**
+ * @brief Bayt kodu yorumlayıcısı
+ *
+ * GCC/Clang'de komutlar hesaplanmış goto ile (`goto *table[op]`)
+ * dağıtılır; diğer derleyicilerde `switch` kullanılır. İşlenen yığını
+ * derleme zamanında hesaplanan derinlikte önceden ayrılır.
+ */
+class VM {
+public:
+    /**
+     * @brief Programı çalıştırmaya hazırlar
+     * @param bc Derlenmiş program; VM'den uzun yaşamalıdır
+     */
+    explicit VM(const Bytecode& bc);
+
+    /**
+     * @brief Programı baştan sona çalıştırır
+     * @param in INPUT kaynağı
+     * @param out PRINT hedefi; satırlar `\n` ile biter, çıkışta boşaltılır
+     * @return Çalıştırılan komut sayısı
+     *
+     * Değişkenler her çalıştırmada sıfırlanır.
+     */
+    std::uint64_t run(std::istream& in, std::ostream& out);
+
+    /** @brief Son çalıştırmadan kalan değişken değerleri (Bytecode::names sırasıyla). */
+    const std::vector<double>& variables() const noexcept { return vars_; }
+
+private:
+    const Bytecode& bc_;
+    std::vector<double> vars_;
+    std::vector<double> stack_;
+    std::vector<std::int32_t> calls_;
+};
+
+} // namespace translator
@@ -3,6 +3,9 @@
 #include "translator/parser.h"
 #include "translator/codegen.h"
 #include "translator/cfg.h"
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
 
 TEST(LexerParser, BasicProgramParse){
     const char* src = R"(10 LET X = 1 + 2
@@ -40,6 +43,88 @@ TEST(Codegen, EmitsCPP){
     // Basic sanity checks
     EXPECT_NE(code.find("#include <iostream>"), std::string::npos);
     EXPECT_NE(code.find("int main()"), std::string::npos);
-    EXPECT_NE(code.find("var[\"X\"] = (1 + (2 * 3))"), std::string::npos);
+    EXPECT_NE(code.find("var[\"X\"] = (1.0 + (2.0 * 3.0))"), std::string::npos);
     EXPECT_NE(code.find("std::cout << var[\"X\"] << std::endl;"), std::string::npos);
 }
+
+TEST(LexerViews, MatchOwnedTokens){
+    const char* src = "10 let Total = (A1 + 22) * 3\n20 PRINT \"hi\", Total\n";
+    translator::Lexer lx(src);
+    auto owned = lx.tokenize();
+    auto views = lx.tokenize_view();
+    ASSERT_EQ(owned.size(), views.size());
+    for (std::size_t i = 0; i < owned.size(); ++i){
+        EXPECT_EQ(owned[i].type, views[i].type);
+        EXPECT_EQ(owned[i].lexeme, views[i].lexeme);
+        EXPECT_EQ(owned[i].line, views[i].line);
+    }
+    EXPECT_EQ(views[1].type, translator::TokenType::KW_LET);
+    EXPECT_EQ(views[1].lexeme, "let");
+    EXPECT_EQ(views[2].type, translator::TokenType::Identifier);
+}
+
+TEST(LexerViews, ParserAcceptsViews){
+    translator::Lexer lx("10 LET X = 4 / 2\n20 PRINT X\n");
+    translator::Parser ps(lx.tokenize_view());
+    auto prog = ps.parseProgram();
+    ASSERT_EQ(prog.stmts.size(), 2u);
+    auto code = translator::Codegen::emit_cpp(prog);
+    EXPECT_NE(code.find("var[\"X\"] = (4.0 / 2.0)"), std::string::npos);
+}
+
+TEST(LexerStream, MatchesInMemoryLexer){
+    const std::string src = "10 LET A = 1\r\n20 PRINT \"two\nlines\", A\n\n30 goto 10";
+    translator::Lexer lx(src);
+    auto expected = lx.tokenize_view();
+    std::istringstream in(src);
+    translator::StreamLexer sl(in);
+    for (const auto& e : expected){
+        auto t = sl.next();
+        EXPECT_EQ(t.type, e.type);
+        EXPECT_EQ(t.lexeme, e.lexeme);
+        EXPECT_EQ(t.line, e.line);
+    }
+    EXPECT_EQ(sl.next().type, translator::TokenType::Eof);
+}
+
+TEST(LexerStream, ParserConsumesIncrementally){
+    std::istringstream in("10 LET X = 1 + 2\n20 PRINT X\n30 GOSUB 10\n");
+    translator::StreamLexer sl(in);
+    translator::Parser ps(sl);
+    auto prog = ps.parseProgram();
+    ASSERT_EQ(prog.stmts.size(), 3u);
+    EXPECT_EQ(prog.labels.back(), 30);
+    auto code = translator::Codegen::emit_cpp(prog);
+    EXPECT_NE(code.find("var[\"X\"] = (1.0 + 2.0)"), std::string::npos);
+}
+
+TEST(LexerNumbers, DecimalsAndExponents){
+    translator::Lexer lx("3.14 .5 1E5 2.5e-3 7e+2 2E X 1.");
+    auto toks = lx.tokenize_view();
+    const char* expected[] = {"3.14", ".5", "1E5", "2.5e-3", "7e+2", "2", "E", "X", "1."};
+    ASSERT_EQ(toks.size(), std::size(expected) + 1);
+    for (std::size_t i = 0; i < std::size(expected); ++i) EXPECT_EQ(toks[i].lexeme, expected[i]);
+    EXPECT_EQ(toks[0].type, translator::TokenType::Number);
+    EXPECT_EQ(toks[5].type, translator::TokenType::Number);
+    EXPECT_EQ(toks[6].type, translator::TokenType::Identifier);
+    EXPECT_EQ(toks.back().type, translator::TokenType::Eof);
+}
+
+TEST(LexerNumbers, ParserConvertsWithoutCopy){
+    translator::Lexer lx("10 LET X = 2.5e-1 + .5\n20 PRINT X * 1E2\n");
+    translator::Parser ps(lx.tokenize_view());
+    auto prog = ps.parseProgram();
+    ASSERT_EQ(prog.stmts.size(), 2u);
+    auto code = translator::Codegen::emit_cpp(prog);
+    EXPECT_NE(code.find("var[\"X\"] = (0.25 + 0.5)"), std::string::npos);
+    EXPECT_NE(code.find("(var[\"X\"] * 100.0)"), std::string::npos);
+}
+
+TEST(LexerNumbers, RejectsFractionalLineNumbers){
+    translator::Lexer lx("10 GOTO 2.5\n");
+    translator::Parser ps(lx.tokenize_view());
+    EXPECT_THROW(ps.parseProgram(), std::runtime_error);
+    translator::Lexer lx2("1.5 PRINT 1\n");
+    translator::Parser ps2(lx2.tokenize_view());
+    EXPECT_THROW(ps2.parseProgram(), std::runtime_error);
+}
@@ -116,9 +116,9 @@ TEST(CodegenPaths, InputGotoIfGosubReturn){
     EXPECT_NE(out.find("std::cin >> tmp"), std::string::npos);
     // IF THEN else bir sonraki etikete gidiş
     EXPECT_NE(out.find("if (var[\"X\"])"), std::string::npos);
-    EXPECT_NE(out.find("else pc = 30;"), std::string::npos); // 20'den sonraki etiket 30
+    EXPECT_NE(out.find("else pc = L30;"), std::string::npos); // 20'den sonraki etiket 30
     // GOSUB çağrısı ve dönüş
-    EXPECT_NE(out.find("call.push(50); pc = 60;"), std::string::npos);
+    EXPECT_NE(out.find("call.push(L50); pc = L60;"), std::string::npos);
     EXPECT_NE(out.find("if (call.empty()) return 0; pc = call.top(); call.pop();"), std::string::npos);
 }
 
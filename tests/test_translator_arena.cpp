@@ -0,0 +1,62 @@
+/**
+ * @file test_translator_arena.cpp
+ * @brief Arena ayırıcısı ve bölgede yaşayan AST düğümleri için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include "translator/arena.h"
+#include "translator/codegen.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+
+using namespace translator;
+
+TEST(Arena, AllocationsAreAligned) {
+    Arena a;
+    a.allocate(1, 1);
+    void* p = a.allocate(sizeof(double), alignof(double));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(double), 0u);
+    a.allocate(3, 1);
+    void* q = a.allocate(64, 32);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(q) % 32, 0u);
+}
+
+TEST(Arena, GrowsPastBlockSizeAndKeepsEarlierData) {
+    Arena a;
+    std::string_view first = a.copy("HELLO");
+    std::string big(200 * 1024, 'x');
+    std::string_view large = a.copy(big);
+    for (int i=0;i<10000;++i) a.make<NumberExpr>(i);
+    EXPECT_EQ(first, "HELLO");
+    EXPECT_EQ(large.size(), big.size());
+    EXPECT_GT(a.block_count(), 1u);
+    EXPECT_GE(a.bytes_used(), big.size());
+}
+
+TEST(Arena, EmptyCopyHasNoStorage) {
+    Arena a;
+    EXPECT_TRUE(a.copy("").empty());
+    EXPECT_EQ(a.bytes_used(), 0u);
+}
+
+TEST(ArenaAst, NodesSurviveProgramMoveAndSourceLifetime) {
+    Program moved;
+    {
+        Lexer lx("10 LET TOTAL = (A + 2) * 3\n20 PRINT TOTAL, A\n");
+        Parser ps(lx);
+        Program p = ps.parseProgram();
+        moved = std::move(p);
+    }
+    ASSERT_EQ(moved.stmts.size(), 2u);
+    auto* let = static_cast<const LetStmt*>(moved.stmts[0]);
+    EXPECT_EQ(let->name, "TOTAL");
+    ASSERT_EQ(let->expr->kind(), ExprKind::Binary);
+    auto* pr = static_cast<const PrintStmt*>(moved.stmts[1]);
+    ASSERT_EQ(pr->items.size(), 2u);
+    EXPECT_EQ(static_cast<const VariableExpr*>(pr->items[1])->name, "A");
+    std::string cpp = Codegen::emit_cpp(moved);
+    EXPECT_NE(cpp.find("var[\"TOTAL\"] = ((var[\"A\"] + 2.0) * 3.0)"), std::string::npos);
+}
@@ -0,0 +1,115 @@
+/**
+ * @file test_translator_batch.cpp
+ * @brief Paralel çoklu dosya çevirisi (run_batch) için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "translator/batch.h"
+#include "translator/codegen.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator_run.h"
+
+namespace fs = std::filesystem;
+using namespace translator;
+using translator_test::read_file;
+
+namespace {
+
+/// Test süresince var olan geçici dizin.
+struct TempDir {
+    fs::path path = fs::temp_directory_path() / "translator_batch_test";
+    TempDir(){ fs::remove_all(path); fs::create_directories(path); }
+    ~TempDir(){ std::error_code ec; fs::remove_all(path, ec); }
+    std::string write(const std::string& name, const std::string& text) const {
+        auto p = (path / name).string(); std::ofstream(p, std::ios::binary) << text; return p;
+    }
+};
+
+std::string program(int i){ return "10 LET X = " + std::to_string(i) + "\n20 PRINT X * 2\n30 GOTO 10\n"; }
+
+} // namespace
+
+TEST(Batch, ParallelResultsAreOrderedAndMatchSerial){
+    TempDir dir;
+    std::vector<BatchJob> jobs;
+    for (int i = 0; i < 24; ++i){
+        std::string in = dir.write("p" + std::to_string(100 + i) + ".bas", i == 7 ? "10 FOO\n" : program(i));
+        jobs.push_back({in, output_path_for(in, (dir.path / "out").string())});
+    }
+    fs::create_directories(dir.path / "out");
+    auto results = run_batch(jobs, 4);
+    ASSERT_EQ(results.size(), jobs.size());
+    for (std::size_t i = 0; i < jobs.size(); ++i){
+        if (i == 7){
+            EXPECT_FALSE(results[i].ok);
+            EXPECT_EQ(results[i].error, "Unknown statement");
+            continue;
+        }
+        ASSERT_TRUE(results[i].ok) << results[i].error;
+        Lexer lx(program(static_cast<int>(i)));
+        EXPECT_EQ(read_file(jobs[i].output), Codegen::emit_cpp(Parser(lx.tokenize_view()).parseProgram()));
+        EXPECT_EQ(results[i].bytes_out, read_file(jobs[i].output).size());
+    }
+}
+
+TEST(Batch, MissingInputIsReportedNotThrown){
+    std::vector<BatchJob> jobs{{"no_such_dir/missing.bas", "no_such_dir/missing.cpp"}};
+    auto results = run_batch(jobs, 2);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_FALSE(results[0].ok);
+    EXPECT_NE(results[0].error.find("Cannot open input"), std::string::npos);
+}
+
+TEST(Batch, ExpandInputsHandlesDirectoriesAndManifests){
+    TempDir dir;
+    dir.write("b.bas", program(1));
+    dir.write("a.bas", program(2));
+    dir.write("notes.txt", "skip me");
+    std::string manifest = dir.write("list.txt", "# comment\n\nx.bas\r\ny.bas\n");
+    auto inputs = expand_inputs({dir.path.string(), "@" + manifest, "z.bas"});
+    ASSERT_EQ(inputs.size(), 5u);
+    EXPECT_EQ(fs::path(inputs[0]).filename(), "a.bas");
+    EXPECT_EQ(fs::path(inputs[1]).filename(), "b.bas");
+    EXPECT_EQ(inputs[2], "x.bas");
+    EXPECT_EQ(inputs[3], "y.bas");
+    EXPECT_EQ(inputs[4], "z.bas");
+    EXPECT_THROW((void)expand_inputs({"@no_such_manifest.txt"}), std::runtime_error);
+}
+
+TEST(Batch, OutputPathFor){
+    EXPECT_EQ(fs::path(output_path_for("dir/prog.bas", "")), fs::path("dir/prog.cpp"));
+    EXPECT_EQ(fs::path(output_path_for("dir/prog.bas", "out")), fs::path("out") / "prog.cpp");
+}
+
+TEST(Batch, SameBasenameInTwoDirectoriesIsRejected){
+    TempDir dir;
+    fs::create_directories(dir.path / "a");
+    fs::create_directories(dir.path / "b");
+    dir.write("a/x.bas", program(1));
+    dir.write("b/x.bas", program(2));
+    const std::string out = (dir.path / "out").string();
+    std::vector<BatchJob> jobs;
+    for (auto& in : expand_inputs({(dir.path / "a").string(), (dir.path / "b").string()})) jobs.push_back({in, output_path_for(in, out)});
+    ASSERT_EQ(jobs.size(), 2u);
+    try {
+        check_unique_outputs(jobs);
+        FAIL() << "collision not detected";
+    } catch (const std::runtime_error& e){
+        const std::string msg = e.what();
+        EXPECT_NE(msg.find("Output collision"), std::string::npos);
+        EXPECT_NE(msg.find(jobs[0].input), std::string::npos);
+        EXPECT_NE(msg.find(jobs[1].input), std::string::npos);
+    }
+
+    // Çıktılar girdilerin yanına yazılırsa çakışma yoktur; aynı yolun farklı yazımı yine çakışır.
+    jobs[0].output = output_path_for(jobs[0].input, "");
+    jobs[1].output = output_path_for(jobs[1].input, "");
+    EXPECT_NO_THROW(check_unique_outputs(jobs));
+    jobs[1].output = out + "/./x.cpp";
+    jobs[0].output = out + "/x.cpp";
+    EXPECT_THROW(check_unique_outputs(jobs), std::runtime_error);
+}
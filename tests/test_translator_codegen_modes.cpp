@@ -0,0 +1,54 @@
+/**
+ * @file test_translator_codegen_modes.cpp
+ * @brief Codegen değişken saklama kipleri (map / slots / locals) için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "translator/codegen.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator_run.h"
+
+using namespace translator;
+using translator_test::emit;
+
+namespace {
+
+const char* const kSrc = "10 INPUT N\n20 LET S = S + N * 2\n30 PRINT S\n";
+
+} // namespace
+
+TEST(CodegenModes, DefaultIsMap) {
+    Lexer lx(kSrc);
+    Parser ps(lx);
+    EXPECT_EQ(Codegen::emit_cpp(ps.parseProgram()), emit(kSrc, {.vars = VarStorage::Map}));
+    std::string code = emit(kSrc, {.vars = VarStorage::Map});
+    EXPECT_NE(code.find("std::unordered_map<std::string,double> var;"), std::string::npos);
+    EXPECT_NE(code.find("var[\"S\"] = (var[\"S\"] + (var[\"N\"] * 2.0));"), std::string::npos);
+}
+
+TEST(CodegenModes, SlotsUseFixedIndices) {
+    std::string code = emit(kSrc, {.vars = VarStorage::Slots});
+    EXPECT_EQ(code.find("unordered_map"), std::string::npos);
+    EXPECT_EQ(code.find("var["), std::string::npos);
+    EXPECT_NE(code.find("double slots[2] = {};  // 0: N, 1: S"), std::string::npos);
+    EXPECT_NE(code.find("std::cin >> tmp; slots[0] = tmp;"), std::string::npos);
+    EXPECT_NE(code.find("slots[1] = (slots[1] + (slots[0] * 2.0));"), std::string::npos);
+    EXPECT_NE(code.find("std::cout << slots[1] << std::endl;"), std::string::npos);
+}
+
+TEST(CodegenModes, LocalsArePrefixedAndZeroInitialised) {
+    std::string code = emit(kSrc, {.vars = VarStorage::Locals});
+    EXPECT_NE(code.find("  double v_N = 0;\n  double v_S = 0;\n"), std::string::npos);
+    EXPECT_NE(code.find("v_S = (v_S + (v_N * 2.0));"), std::string::npos);
+    EXPECT_EQ(code.find("unordered_map"), std::string::npos);
+}
+
+TEST(CodegenModes, EmptyProgramDeclaresNoSlots) {
+    Program p;
+    CodegenOptions opts; opts.vars = VarStorage::Slots;
+    std::string code = Codegen::emit_cpp(p, opts);
+    EXPECT_EQ(code.find("slots["), std::string::npos);
+    EXPECT_NE(code.find("return 0;"), std::string::npos);
+}
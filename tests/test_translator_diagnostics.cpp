@@ -0,0 +1,94 @@
+/**
+ * @file test_translator_diagnostics.cpp
+ * @brief Hata kurtarmalı çözümleme ve sütun bilgisi için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "translator/lexer.h"
+#include "translator/parser.h"
+
+using namespace translator;
+
+TEST(Diagnostics, LexerTracksColumns) {
+    Lexer lx("10 LET X = 1\n  20 PRINT \"a\nb\", X\n");
+    auto toks = lx.tokenize_view();
+    EXPECT_EQ(toks[0].column, 1);   // 10
+    EXPECT_EQ(toks[1].column, 4);   // LET
+    EXPECT_EQ(toks[4].column, 12);  // 1
+    EXPECT_EQ(toks[6].line, 2);     // 20
+    EXPECT_EQ(toks[6].column, 3);
+    EXPECT_EQ(toks[8].type, TokenType::String);
+    EXPECT_EQ(toks[8].column, 12);
+    EXPECT_EQ(toks[10].line, 3);    // X, dizenin bittiği satırda
+    EXPECT_EQ(toks[10].column, 5);
+}
+
+TEST(Diagnostics, StreamLexerColumnsMatch) {
+    const std::string src = "10 LET X = 1\n  20 PRINT \"a\nb\", X\n";
+    Lexer lx(src);
+    auto expected = lx.tokenize_view();
+    std::istringstream in(src);
+    StreamLexer sl(in);
+    for (const auto& e : expected) {
+        auto t = sl.next();
+        if (e.type == TokenType::Eof) break;
+        EXPECT_EQ(t.line, e.line);
+        EXPECT_EQ(t.column, e.column);
+    }
+}
+
+TEST(Diagnostics, CollectsAllErrorsInOnePass) {
+    Lexer lx("10 LET X = (1 + 2\n"
+             "20 PRINT X\n"
+             "30 FOO\n"
+             "40 GOTO\n"
+             "50 LET Y = X * 2\n"
+             "60 IF X 70\n");
+    Parser ps(lx);
+    ParseResult r = ps.parse();
+    ASSERT_EQ(r.errors.size(), 4u);
+    EXPECT_EQ(r.errors[0].message, "Expected )");
+    EXPECT_EQ(r.errors[0].line, 1);
+    EXPECT_EQ(r.errors[0].column, 18);
+    EXPECT_EQ(r.errors[1].message, "Unknown statement");
+    EXPECT_EQ(r.errors[1].line, 3);
+    EXPECT_EQ(r.errors[1].column, 4);
+    EXPECT_EQ(r.errors[2].message, "Expected line number after GOTO");
+    EXPECT_EQ(r.errors[2].line, 4);
+    EXPECT_EQ(r.errors[3].message, "Expected THEN");
+    EXPECT_EQ(r.errors[3].line, 6);
+    EXPECT_EQ(r.errors[3].column, 9);
+    EXPECT_FALSE(r.ok());
+
+    // Hatasız deyimler kısmi programda kalır.
+    ASSERT_EQ(r.program.stmts.size(), 2u);
+    EXPECT_EQ(r.program.labels[0], 20);
+    EXPECT_EQ(r.program.labels[1], 50);
+    EXPECT_EQ(r.program.index.find(20), 0);
+    EXPECT_EQ(r.program.index.find(10), LabelIndex::npos);
+}
+
+TEST(Diagnostics, CleanInputHasNoErrors) {
+    Lexer lx("10 LET X = 1\n20 PRINT X\n");
+    ParseResult r = Parser(lx).parse();
+    EXPECT_TRUE(r.ok());
+    EXPECT_EQ(r.program.stmts.size(), 2u);
+}
+
+TEST(Diagnostics, ParseProgramThrowsFirstError) {
+    Lexer lx("10 FOO\n20 LET = 1\n");
+    Parser ps(lx);
+    try { (void)ps.parseProgram(); FAIL() << "expected throw"; }
+    catch (const std::runtime_error& e) { EXPECT_STREQ(e.what(), "Unknown statement"); }
+}
+
+TEST(Diagnostics, ErrorAtEndOfInputTerminates) {
+    Lexer lx("10 PRINT (");
+    ParseResult r = Parser(lx).parse();
+    ASSERT_EQ(r.errors.size(), 1u);
+    EXPECT_EQ(r.errors[0].message, "Unexpected token in factor");
+    EXPECT_TRUE(r.program.stmts.empty());
+}
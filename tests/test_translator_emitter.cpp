@@ -0,0 +1,84 @@
+/**
+ * @file test_translator_emitter.cpp
+ * @brief Kod üretimi çıktı tamponu (Emitter) için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include "translator/codegen.h"
+#include "translator/emitter.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator_run.h"
+
+namespace fs = std::filesystem;
+using namespace translator;
+using translator_test::read_file;
+
+TEST(Emitter, FormatsTextAndNumbers){
+    Emitter e(1);
+    e << "x = " << 42 << ' ' << std::int64_t{-7} << ' ' << std::size_t{18446744073709551615ull} << ' ';
+    e << 0.5 << ' ' << 3.0 << ' ' << 1.0 / 3 << ' ' << 1e300 << ' ' << std::string("end");
+    EXPECT_EQ(e.size(), e.view().size());
+    EXPECT_EQ(e.take(), "x = 42 -7 18446744073709551615 0.5 3 0.3333333333333333 1e+300 end");
+    EXPECT_EQ(e.size(), 0u);
+}
+
+TEST(Emitter, GrowsFromSmallCapacity){
+    Emitter e(1);
+    std::string expected;
+    for (int i = 0; i < 5000; ++i){ e << "line " << i << '\n'; expected += "line " + std::to_string(i) + "\n"; }
+    EXPECT_EQ(e.take(), expected);
+}
+
+TEST(Emitter, WritesToFileInChunks){
+    const std::string path = (fs::temp_directory_path() / "translator_emitter_test.txt").string();
+    std::string expected;
+    {
+        Emitter e = Emitter::open(path, 64);
+        for (int i = 0; i < 1000; ++i){ e << "row " << i << '\n'; expected += "row " + std::to_string(i) + "\n"; }
+        // Parçalar yazıldıkça tampon boşalır; yalnızca son parça bellekte kalır.
+        EXPECT_LT(e.view().size(), 128u);
+        EXPECT_EQ(e.size(), expected.size());
+        EXPECT_TRUE(e.flush());
+    }
+    EXPECT_EQ(read_file(path), expected);
+    fs::remove(path);
+}
+
+TEST(Emitter, DiscardDropsOnlyUnflushedText){
+    const std::string path = (fs::temp_directory_path() / "translator_emitter_discard.txt").string();
+    {
+        Emitter e = Emitter::open(path, 8);
+        e << "0123456789";   // eşiği aşar, yazılır
+        e << "tail";
+        EXPECT_EQ(e.flushed(), 10u);
+        e.discard();
+        EXPECT_EQ(e.size(), 10u);
+    }
+    EXPECT_EQ(read_file(path), "0123456789");
+    fs::remove(path);
+}
+
+TEST(Emitter, OpenFailsForMissingDirectory){
+    EXPECT_THROW((void)Emitter::open("no_such_dir/out.cpp"), std::runtime_error);
+}
+
+TEST(Emitter, CodegenToFileMatchesString){
+    Lexer lx("10 LET X = 2.5 * (Y + 1) / 3\n20 PRINT X, Y\n30 IF X THEN 10\n40 GOSUB 60\n50 GOTO 999\n60 RETURN\n");
+    Program prog = Parser(lx).parseProgram();
+    const std::string path = (fs::temp_directory_path() / "translator_emitter_codegen.cpp").string();
+    for (ControlFlow flow : {ControlFlow::Dispatch, ControlFlow::Blocks, ControlFlow::Structured}){
+        CodegenOptions opts; opts.flow = flow; opts.vars = VarStorage::Slots;
+        {
+            Emitter out = Emitter::open(path, 16);
+            Codegen::emit_cpp(prog, opts, out);
+            ASSERT_TRUE(out.flush());
+        }
+        EXPECT_EQ(read_file(path), Codegen::emit_cpp(prog, opts));
+    }
+    fs::remove(path);
+}
@@ -0,0 +1,144 @@
+/**
+ * @file test_translator_expressions.cpp
+ * @brief Yığın tabanlı ifade çözümleyici: öncelik, tekli eksi, karşılaştırmalar ve derinlik.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "translator/codegen.h"
+#include "translator/flat_ast.h"
+#include "translator/interpreter.h"
+#include "translator/lexer.h"
+#include "translator/optimize.h"
+#include "translator/parser.h"
+#include "translator/vm.h"
+#include "translator_run.h"
+
+using namespace translator;
+using translator_test::interpret;
+using translator_test::run_vm;
+
+namespace {
+
+/// İfadeyi tam parantezli biçimde yazar; ağacın şeklini doğrulamak için.
+std::string show(const Expr* e){
+    switch (e->kind()){
+        case ExprKind::Number: { std::ostringstream os; os << static_cast<const NumberExpr*>(e)->value; return os.str(); }
+        case ExprKind::Variable: return std::string(static_cast<const VariableExpr*>(e)->name);
+        case ExprKind::Binary: break;
+    }
+    auto* b = static_cast<const BinaryExpr*>(e);
+    return "(" + show(b->lhs) + " " + b->op + " " + show(b->rhs) + ")";
+}
+
+/// `10 LET X = <expr>` deyimini çözümleyip ifadeyi gösterir.
+std::string parse_show(const std::string& expr){
+    Lexer lx("10 LET X = " + expr + "\n");
+    Program p = Parser(lx).parseProgram();
+    return show(static_cast<const LetStmt*>(p.stmts[0])->expr);
+}
+
+} // namespace
+
+TEST(Expressions, LexesComparisonOperators){
+    Lexer lx("< > <= >= <> =");
+    auto toks = lx.tokenize_view();
+    ASSERT_EQ(toks.size(), 7u);
+    EXPECT_EQ(toks[0].type, TokenType::Less);
+    EXPECT_EQ(toks[1].type, TokenType::Greater);
+    EXPECT_EQ(toks[2].type, TokenType::LessEqual);
+    EXPECT_EQ(toks[3].type, TokenType::GreaterEqual);
+    EXPECT_EQ(toks[4].type, TokenType::NotEqual);
+    EXPECT_EQ(toks[4].lexeme, "<>");
+    EXPECT_EQ(toks[4].column, 11);
+    EXPECT_EQ(toks[5].type, TokenType::Assign);
+}
+
+TEST(Expressions, PrecedenceAndAssociativity){
+    EXPECT_EQ(parse_show("A + B * C"), "(A + (B * C))");
+    EXPECT_EQ(parse_show("A - B - C"), "((A - B) - C)");
+    EXPECT_EQ(parse_show("A / B * C"), "((A / B) * C)");
+    EXPECT_EQ(parse_show("(A + B) * C"), "((A + B) * C)");
+    EXPECT_EQ(parse_show("A + B < C * D"), "((A + B) < (C * D))");
+    EXPECT_EQ(parse_show("A <= B"), "(A L B)");
+    EXPECT_EQ(parse_show("A >= B"), "(A G B)");
+    EXPECT_EQ(parse_show("A <> B"), "(A N B)");
+    EXPECT_EQ(parse_show("A = B"), "(A = B)");
+}
+
+TEST(Expressions, UnaryMinus){
+    EXPECT_EQ(parse_show("-5"), "-5");
+    EXPECT_EQ(parse_show("-A * B"), "((0 - A) * B)");
+    EXPECT_EQ(parse_show("A * -B"), "(A * (0 - B))");
+    EXPECT_EQ(parse_show("2 - -3"), "(2 - -3)");
+    EXPECT_EQ(parse_show("--A"), "(0 - (0 - A))");
+    EXPECT_EQ(parse_show("-(A + 1)"), "(0 - (A + 1))");
+    EXPECT_EQ(parse_show("+A"), "A");
+}
+
+TEST(Expressions, DeepNestingDoesNotRecurse){
+    // A+(A+(...(A+1))): her düzey gerçek bir ikili düğümdür; tüm geçişler derinliği gezer.
+    const int depth = 200000;
+    std::string deep;
+    for (int i = 0; i < depth; ++i) deep += "A+(";
+    deep += "1" + std::string(depth, ')');
+    const std::string src = "10 LET A = 1\n20 LET X = " + deep + "\n30 PRINT X\n";
+    Lexer lx(src);
+    ParseResult r = Parser(lx).parse();
+    ASSERT_TRUE(r.errors.empty());
+
+    FlatProgram f = flatten(r.program);
+    EXPECT_EQ(f.expr_kind.size(), 2u * depth + 3);   // A'nın sabiti, her düzeyde + ve A, en içte 1, PRINT'teki X
+    const std::string code = Codegen::emit_cpp(r.program, CodegenOptions{});
+    EXPECT_NE(code.find("var[\"X\"] = (var[\"A\"] + (var[\"A\"] + ("), std::string::npos);
+    CodegenOptions opts; opts.optimize = true;
+    const std::string folded = Codegen::emit_cpp(r.program, opts);   // A yayılır, zincir tek sabite katlanır
+    EXPECT_NE(folded.find("std::cout << 200001.0 << std::endl;"), std::string::npos) << folded.substr(0, 400);
+
+    Bytecode bc = compile_bytecode(r.program);
+    EXPECT_EQ(bc.max_stack, static_cast<std::size_t>(depth) + 1);
+    EXPECT_EQ(interpret(src), "200001\n");
+    EXPECT_EQ(run_vm(src), "200001\n");
+}
+
+TEST(Expressions, ErrorsKeepPositions){
+    Lexer lx("10 LET X = ((1 + 2)\n20 LET Y = 3 * \n30 LET Z = 1 <\n40 PRINT 1\n");
+    ParseResult r = Parser(lx).parse();
+    ASSERT_EQ(r.errors.size(), 3u);
+    EXPECT_EQ(r.errors[0].message, "Expected )");
+    EXPECT_EQ(r.errors[0].column, 20);
+    EXPECT_EQ(r.errors[1].message, "Unexpected token in factor");
+    EXPECT_EQ(r.errors[1].line, 2);
+    EXPECT_EQ(r.errors[2].message, "Unexpected token in factor");
+    EXPECT_EQ(r.errors[2].line, 3);
+    EXPECT_EQ(r.program.labels, (std::vector<int>{40}));
+}
+
+TEST(Expressions, ComparisonsDriveIfInEveryBackend){
+    const std::string src =
+        "10 LET I = 0\n"
+        "20 LET I = I + 1\n"
+        "30 IF I < 3 THEN 20\n"
+        "40 PRINT I, I <> 3, I >= 3, -I <= -4, I = 3\n";
+    EXPECT_EQ(interpret(src), "30101\n");
+    EXPECT_EQ(run_vm(src), "30101\n");
+}
+
+TEST(Expressions, CodegenSpellsComparisonsInCpp){
+    Lexer lx("10 IF A <> B THEN 10\n20 LET C = A = B\n30 LET D = A <= -B\n");
+    Program p = Parser(lx).parseProgram();
+    std::string code = Codegen::emit_cpp(p);
+    EXPECT_NE(code.find("(var[\"A\"] != var[\"B\"])"), std::string::npos);
+    EXPECT_NE(code.find("(var[\"A\"] == var[\"B\"])"), std::string::npos);
+    EXPECT_NE(code.find("(var[\"A\"] <= (0.0 - var[\"B\"]))"), std::string::npos);
+}
+
+TEST(Expressions, OptimizerFoldsComparisons){
+    Lexer lx("10 LET X = 1 < 2\n20 LET Y = 2 <> 2\n30 PRINT X, Y\n");
+    Program p = Parser(lx).parseProgram();
+    FlatProgram f = flatten(p);
+    OptimizeStats st = optimize(f);
+    EXPECT_GE(st.folded, 2u);
+    ASSERT_EQ(f.expr_kind[f.stmt_a[0]], ExprKind::Number);
+}
@@ -0,0 +1,87 @@
+/**
+ * @file test_translator_flat_ast.cpp
+ * @brief Düz (struct-of-arrays) AST dönüştürücüsü ve onu kullanan geçişler için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "translator/cfg.h"
+#include "translator/codegen.h"
+#include "translator/flat_ast.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+
+using namespace translator;
+
+namespace {
+
+/// Verilen kaynağı çözümler.
+Program parse(const std::string& src){
+    Lexer lx(src);
+    Parser ps(lx);
+    return ps.parseProgram();
+}
+
+const char* const kSample =
+    "10 LET X = 1 + 2 * 3\n"
+    "20 INPUT Y\n"
+    "30 IF X - Y THEN 60\n"
+    "40 GOSUB 70\n"
+    "50 GOTO 80\n"
+    "60 PRINT X, Y, X * Y\n"
+    "70 RETURN\n"
+    "80 PRINT X\n";
+
+} // namespace
+
+TEST(FlatAst, ExpressionsArePostOrderAndNamesInterned) {
+    Program prog = parse(kSample);
+    FlatProgram f = flatten(prog);
+    ASSERT_EQ(f.size(), prog.stmts.size());
+    EXPECT_EQ(f.labels, prog.labels);
+    ASSERT_EQ(f.names.size(), 2u);
+    EXPECT_EQ(f.names[0], "X");
+    EXPECT_EQ(f.names[1], "Y");
+    for (std::size_t i=0;i<f.expr_kind.size();++i){
+        if (f.expr_kind[i] != ExprKind::Binary) continue;
+        EXPECT_LT(f.expr_a[i], static_cast<NodeIndex>(i));
+        EXPECT_LT(f.expr_b[i], static_cast<NodeIndex>(i));
+    }
+    EXPECT_EQ(f.stmt_kind[0], StmtKind::Let);
+    EXPECT_EQ(f.stmt_a[0], 0);
+    NodeIndex root = f.stmt_b[0];
+    EXPECT_EQ(f.expr_op[root], '+');
+    EXPECT_EQ(f.numbers[f.expr_a[f.expr_a[root]]], 1.0);
+    EXPECT_EQ(f.stmt_kind[1], StmtKind::Input);
+    EXPECT_EQ(f.stmt_a[1], 1);
+    EXPECT_EQ(f.stmt_kind[2], StmtKind::IfGoto);
+    EXPECT_EQ(f.stmt_a[2], 60);
+    EXPECT_EQ(f.stmt_kind[5], StmtKind::Print);
+    EXPECT_EQ(f.stmt_b[5], 3);
+    EXPECT_EQ(f.expr_op[f.items[f.stmt_a[5] + 2]], '*');
+}
+
+TEST(FlatAst, CodegenMatchesPointerProgram) {
+    Program prog = parse(kSample);
+    FlatProgram f = flatten(prog);
+    EXPECT_EQ(Codegen::emit_cpp(f), Codegen::emit_cpp(prog));
+}
+
+TEST(FlatAst, CfgMatchesPointerProgram) {
+    Program prog = parse(kSample);
+    CFG a = build_cfg(prog);
+    CFG b = build_cfg(flatten(prog));
+    ASSERT_EQ(a.g.size(), b.g.size());
+    for (int i=0;i<a.g.size();++i) EXPECT_EQ(a.g.neighbors(i), b.g.neighbors(i)) << "node " << i;
+    EXPECT_EQ(a.label_to_index, b.label_to_index);
+    EXPECT_EQ(b.g.neighbors(2), (std::vector<int>{5, 3}));
+    EXPECT_TRUE(b.g.neighbors(6).empty());
+}
+
+TEST(FlatAst, EmptyProgram) {
+    Program prog;
+    FlatProgram f = flatten(prog);
+    EXPECT_TRUE(f.empty());
+    EXPECT_EQ(Codegen::emit_cpp(f), Codegen::emit_cpp(prog));
+    EXPECT_EQ(build_cfg(f).g.size(), 0);
+}
@@ -0,0 +1,216 @@
+/**
+ * @file test_translator_for.cpp
+ * @brief FOR/TO/STEP/NEXT döngüleri: çözümleme, eşleştirme hataları, arka uçlar ve doğal `for` üretimi.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include "translator/codegen.h"
+#include "translator/emitter.h"
+#include "translator/flat_ast.h"
+#include "translator/interpreter.h"
+#include "translator/lexer.h"
+#include "translator/optimize.h"
+#include "translator/parser.h"
+#include "translator/types.h"
+#include "translator/vm.h"
+#include "translator_run.h"
+
+using namespace translator;
+using translator_test::compile_and_run;
+using translator_test::emit;
+using translator_test::have_compiler;
+using translator_test::interpret;
+using translator_test::run_vm;
+
+namespace {
+
+const char* kNested =
+    "10 LET S = 0\n"
+    "20 FOR I = 1 TO 10\n"
+    "30 LET S = S + I\n"
+    "40 NEXT I\n"
+    "50 PRINT S, I\n"
+    "60 FOR J = 10 TO 1 STEP -3\n"
+    "70 FOR K = 1 TO J / 2\n"
+    "80 LET S = S + K\n"
+    "90 NEXT\n"
+    "100 NEXT J\n"
+    "110 PRINT S, J, K\n"
+    "120 FOR X = 5 TO 1\n"
+    "130 PRINT X\n"
+    "140 NEXT X\n"
+    "150 PRINT X\n";
+
+const char* kNestedOut = "5511\n79-21\n5\n";
+
+} // namespace
+
+TEST(ForLoops, ParsesStepAndBareNext){
+    Lexer lx("10 FOR I = 1 TO N STEP 2\n20 FOR J = 0 TO 3\n30 NEXT\n40 NEXT I\n");
+    ParseResult r = Parser(lx).parse();
+    ASSERT_TRUE(r.errors.empty());
+    ASSERT_EQ(r.program.stmts.size(), 4u);
+    auto* outer = static_cast<const ForStmt*>(r.program.stmts[0]);
+    auto* inner = static_cast<const ForStmt*>(r.program.stmts[1]);
+    EXPECT_EQ(outer->name, "I");
+    ASSERT_NE(outer->step, nullptr);
+    EXPECT_EQ(inner->step, nullptr);
+    EXPECT_EQ(inner->exit, 40);
+    EXPECT_EQ(outer->exit, -1);   // son NEXT'ten sonra deyim yok
+
+    // Çıplak NEXT en içteki FOR'a bağlanır; gövde FOR'dan sonraki etikettir.
+    auto* bare = static_cast<const NextStmt*>(r.program.stmts[2]);
+    auto* named = static_cast<const NextStmt*>(r.program.stmts[3]);
+    EXPECT_EQ(bare->id, inner->id);
+    EXPECT_EQ(bare->body, 30);
+    EXPECT_EQ(named->id, outer->id);
+    EXPECT_EQ(named->body, 20);
+}
+
+TEST(ForLoops, PairingErrorsKeepPositions){
+    Lexer lx("10 NEXT I\n20 FOR I = 1 TO 3\n30 FOR J = 1 TO 2\n40 NEXT I\n50 FOR K = 1\n");
+    ParseResult r = Parser(lx).parse();
+    // Eşleşmeyen NEXT reddedildiğinden iki FOR da açık kalır; hatalar satır sırasındadır.
+    ASSERT_EQ(r.errors.size(), 5u);
+    EXPECT_EQ(r.errors[0].message, "NEXT without FOR");
+    EXPECT_EQ(r.errors[0].line, 1);
+    EXPECT_EQ(r.errors[1].message, "FOR without NEXT");
+    EXPECT_EQ(r.errors[1].line, 2);
+    EXPECT_EQ(r.errors[1].column, 4);
+    EXPECT_EQ(r.errors[2].message, "FOR without NEXT");
+    EXPECT_EQ(r.errors[2].line, 3);
+    EXPECT_EQ(r.errors[3].message, "NEXT variable does not match FOR");
+    EXPECT_EQ(r.errors[3].line, 4);
+    EXPECT_EQ(r.errors[4].message, "Expected TO");
+    EXPECT_EQ(r.errors[4].line, 5);
+}
+
+TEST(ForLoops, MismatchedNextDeclaresNoVariable){
+    Lexer lx("10 FOR I = 1 TO 3\n20 NEXT J\n30 NEXT I\n");
+    ParseResult r = Parser(lx).parse();
+    ASSERT_EQ(r.errors.size(), 1u);
+    EXPECT_EQ(r.errors[0].message, "NEXT variable does not match FOR");
+    EXPECT_EQ(r.program.symbols.size(), 1u);
+    EXPECT_EQ(r.program.symbols.find("J"), Interner::npos);
+}
+
+TEST(ForLoops, InterpreterAndVmAgree){
+    EXPECT_EQ(interpret(kNested), kNestedOut);
+    EXPECT_EQ(run_vm(kNested), kNestedOut);
+
+    // Sınır girişte bir kez değerlendirilir; gövdede değişmesi döngüyü uzatmaz.
+    const char* hoisted = "10 LET N = 3\n20 FOR Z = 1 TO N\n30 LET N = 10\n40 NEXT Z\n50 PRINT Z, N\n";
+    EXPECT_EQ(interpret(hoisted), "410\n");
+    EXPECT_EQ(run_vm(hoisted), "410\n");
+
+    // Kesirli adım ve gövdeden dışarı atlama.
+    const char* frac = "10 FOR Y = 0 TO 1 STEP 0.25\n20 IF Y = 0.5 THEN 50\n30 NEXT Y\n40 PRINT 99\n50 PRINT Y\n";
+    EXPECT_EQ(interpret(frac), "0.5\n");
+    EXPECT_EQ(run_vm(frac), "0.5\n");
+}
+
+TEST(ForLoops, NanLimitSkipsBodyEverywhere){
+    // Giriş koşulu NEXT'in sürme koşulunun tam değilidir: 1 <= NaN yanlış olduğundan gövde hiç çalışmaz.
+    const char* src = "10 LET Z = 0\n20 FOR I = 1 TO Z / Z\n30 PRINT I\n40 NEXT I\n50 PRINT 7\n";
+    EXPECT_EQ(interpret(src), "7\n");
+    EXPECT_EQ(run_vm(src), "7\n");
+    if (!have_compiler()) GTEST_SKIP() << "no C++ compiler: " << TRANSLATOR_TEST_CXX;
+    int n = 0;
+    for (ControlFlow flow : {ControlFlow::Dispatch, ControlFlow::Blocks, ControlFlow::Structured})
+        for (bool typed : {false, true}){
+            const std::string code = emit(src, {.vars = VarStorage::Locals, .flow = flow, .typed = typed});
+            std::string got;
+            ASSERT_TRUE(compile_and_run("for_nan_" + std::to_string(n++), code, got));
+            EXPECT_EQ(got, "7\n") << code;
+        }
+}
+
+TEST(ForLoops, StructuredEmitsNativeFor){
+    std::string code = emit(kNested, {.vars = VarStorage::Locals, .flow = ControlFlow::Structured});
+    EXPECT_NE(code.find("for (v_I = 1.0; v_I <= 10.0; v_I += 1.0) {"), std::string::npos);
+    EXPECT_NE(code.find("for (v_J = 10.0; v_J >= 1.0; v_J += -3.0) {"), std::string::npos);
+    // Sabit olmayan sınır döngüden önce bir kez hesaplanır; sabitler gizli değişken istemez.
+    EXPECT_NE(code.find("to_80 = (v_J / 2.0);"), std::string::npos);
+    EXPECT_NE(code.find("for (v_K = 1.0; v_K <= to_80; v_K += 1.0) {"), std::string::npos);
+    EXPECT_EQ(code.find("to_30"), std::string::npos);
+    EXPECT_EQ(code.find("step_"), std::string::npos);
+}
+
+TEST(ForLoops, JumpIntoBodyFallsBackToHiddenBounds){
+    // FOR'a uğranmadığından sınır ve adım 0'dır; NEXT gövdeye döner, sayaç döngüyü bitirir.
+    const char* src = "10 GOTO 40\n20 FOR I = 1 TO 3\n30 PRINT I\n40 LET Q = Q + 1\n50 IF Q > 3 THEN 70\n60 NEXT I\n70 PRINT Q, I\n";
+    std::string code = emit(src, {.vars = VarStorage::Locals, .flow = ControlFlow::Structured});
+    EXPECT_EQ(code.find("for (v_I"), std::string::npos);
+    EXPECT_NE(code.find("to_30 = 3.0;"), std::string::npos);
+    EXPECT_EQ(interpret(src), "0\n0\n0\n40\n");
+    EXPECT_EQ(run_vm(src), "0\n0\n0\n40\n");
+}
+
+TEST(ForLoops, DispatchUsesHiddenBoundAndStep){
+    std::string code = emit(kNested, {.vars = VarStorage::Map, .flow = ControlFlow::Dispatch});
+    EXPECT_NE(code.find("double to_30 = 0;"), std::string::npos);
+    EXPECT_NE(code.find("to_30 = 10.0; step_30 = 1.0; var[\"I\"] = 1.0;"), std::string::npos);
+    EXPECT_NE(code.find("var[\"I\"] += step_30;"), std::string::npos);
+}
+
+TEST(ForLoops, StreamingAddsExitCase){
+    Lexer lx("10 FOR I = 1 TO 3\n20 PRINT I\n30 NEXT I\n40 PRINT I\n");
+    Emitter out;
+    StreamCodegen gen(out);
+    auto errors = Parser(lx).parse_each([&](int label, const Stmt* st, const Interner& symbols){ gen.statement(label, st, symbols); });
+    ASSERT_TRUE(errors.empty());
+    gen.finish();
+    std::string code = out.take();
+    // FOR çıkışını henüz görmeden yazar; çıkış NEXT'ten sonraki deyime eşlik eden sentetik bir case'tir.
+    EXPECT_NE(code.find("var[\"to 20\"] = 3.0;"), std::string::npos);
+    EXPECT_NE(code.find("pc = -21; else pc = 20;"), std::string::npos);
+    EXPECT_NE(code.find("case -21:\n    case 40:"), std::string::npos);
+}
+
+TEST(ForLoops, StreamingExitCaseOfLargestLabel){
+    Lexer lx("0 FOR I = 5 TO 2\n2147483647 PRINT I\n2147483646 NEXT I\n10 PRINT 99\n");
+    Emitter out;
+    StreamCodegen gen(out);
+    auto errors = Parser(lx).parse_each([&](int label, const Stmt* st, const Interner& symbols){ gen.statement(label, st, symbols); });
+    ASSERT_TRUE(errors.empty());
+    gen.finish();
+    std::string code = out.take();
+    // Gövde etiketi en büyük int olsa da çıkış ayrı bir negatif case'tir.
+    EXPECT_NE(code.find("pc = -2147483648; else pc = 2147483647;"), std::string::npos);
+    EXPECT_NE(code.find("case -2147483648:\n    case 10:"), std::string::npos);
+    EXPECT_EQ(code.find("case 2147483647:"), code.rfind("case 2147483647:"));
+}
+
+TEST(ForLoops, OptimizerKeepsLoopAndFoldsBounds){
+    Lexer lx("10 LET N = 2 * 3\n20 FOR I = 1 TO N\n30 LET S = S + I\n40 NEXT I\n50 PRINT S\n");
+    Program p = Parser(lx).parseProgram();
+    FlatProgram f = flatten(p);
+    optimize(f);
+    eliminate_dead_code(f);
+    std::size_t fors = 0, nexts = 0;
+    for (StmtKind k : f.stmt_kind){ fors += k == StmtKind::For; nexts += k == StmtKind::Next; }
+    EXPECT_EQ(fors, 1u);
+    EXPECT_EQ(nexts, 1u);
+
+    CodegenOptions opts; opts.vars = VarStorage::Locals; opts.flow = ControlFlow::Structured;
+    std::string code = Codegen::emit_cpp(f, opts);
+    EXPECT_NE(code.find("for (v_I = 1.0; v_I <= 6.0; v_I += 1.0) {"), std::string::npos);
+}
+
+TEST(ForLoops, TypedLoopVariable){
+    Lexer lx("10 FOR I = 1 TO 2.5\n20 NEXT I\n30 FOR R = 0 TO 1 STEP 0.5\n40 NEXT R\n");
+    FlatProgram f = flatten(Parser(lx).parseProgram());
+    TypeInfo t = infer_types(f);
+    const auto id = [&](const char* name){ return std::find(f.names.begin(), f.names.end(), name) - f.names.begin(); };
+    ASSERT_LT(id("I"), static_cast<std::ptrdiff_t>(f.names.size()));
+    ASSERT_LT(id("R"), static_cast<std::ptrdiff_t>(f.names.size()));
+    EXPECT_EQ(t.vars[id("I")], ValueType::Int);     // kesirli sınır yalnızca karşılaştırılır
+    EXPECT_EQ(t.vars[id("R")], ValueType::Double);  // kesirli adım atanır
+    std::string code = emit(kNested, {.vars = VarStorage::Locals, .flow = ControlFlow::Structured, .typed = true});
+    EXPECT_NE(code.find("std::int64_t v_I = 0;"), std::string::npos);
+    EXPECT_NE(code.find("std::int64_t v_K = 0;"), std::string::npos);
+    EXPECT_NE(code.find("double to_80 = 0;"), std::string::npos);    // J / 2 sınırı kesirli, K yine tamsayı
+}
@@ -0,0 +1,113 @@
+/**
+ * @file test_translator_incremental.cpp
+ * @brief Artımlı çeviri önbelleği (TranslationCache) için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "translator/codegen.h"
+#include "translator/incremental.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+
+namespace fs = std::filesystem;
+using namespace translator;
+
+namespace {
+
+/// Varsayılan seçeneklerle tam çeviri.
+std::string full(const std::string& src){
+    Lexer lx(src);
+    Parser ps(lx);
+    return Codegen::emit_cpp(ps.parseProgram());
+}
+
+const char* const kBase =
+    "10 LET X = 1\n"
+    "20 PRINT X * 2, Y\n"
+    "30 IF X - 5 THEN 50\n"
+    "40 GOTO 90\n"
+    "50 GOSUB 100\n"
+    "60 LET X = X + 1\n"
+    "70 GOTO 20\n"
+    "100 INPUT Y\n"
+    "110 RETURN\n";
+
+} // namespace
+
+TEST(Incremental, OutputMatchesFullTranslation) {
+    TranslationCache cache;
+    EXPECT_EQ(cache.translate(kBase), full(kBase));
+    EXPECT_EQ(cache.stats().hits, 0u);
+    EXPECT_EQ(cache.stats().misses, 9u);
+    EXPECT_EQ(cache.translate(""), full(""));
+}
+
+TEST(Incremental, OnlyChangedLinesAreRetranslated) {
+    TranslationCache cache;
+    cache.translate(kBase);
+    std::string edited = kBase;
+    edited.replace(edited.find("X + 1"), 5, "X + 2");
+    EXPECT_EQ(cache.translate(edited), full(edited));
+    EXPECT_EQ(cache.stats().hits, 8u);
+    EXPECT_EQ(cache.stats().misses, 1u);
+    EXPECT_FALSE(cache.stats().fallback);
+
+    // Yeni satır yalnızca kendisini ve sonraki etiketi değişen öncülünü etkiler.
+    std::string inserted = edited;
+    inserted.insert(inserted.find("60 "), "55 PRINT 0\n");
+    EXPECT_EQ(cache.translate(inserted), full(inserted));
+    EXPECT_EQ(cache.stats().hits, 8u);
+    EXPECT_EQ(cache.stats().misses, 2u);
+
+    // Boşluk ve boş satırlar bloğu geçersiz kılmaz.
+    std::string spaced = "\n  " + inserted + "\r\n\n";
+    EXPECT_EQ(cache.translate(spaced), full(spaced));
+    EXPECT_EQ(cache.stats().misses, 0u);
+}
+
+TEST(Incremental, PersistsAcrossInstances) {
+    fs::path path = fs::temp_directory_path() / "translator_incremental_test.cache";
+    fs::remove(path);
+    {
+        TranslationCache cache;
+        EXPECT_FALSE(cache.load(path.string()));
+        cache.translate(kBase);
+        ASSERT_TRUE(cache.save(path.string()));
+    }
+    TranslationCache cache;
+    ASSERT_TRUE(cache.load(path.string()));
+    EXPECT_EQ(cache.size(), 9u);
+    EXPECT_EQ(cache.translate(kBase), full(kBase));
+    EXPECT_EQ(cache.stats().hits, 9u);
+    EXPECT_EQ(cache.stats().misses, 0u);
+
+    // Başka bir kod üreticinin yazdığı bloklar yüklenmez.
+    std::string saved;
+    { std::ifstream in(path, std::ios::binary); std::getline(in, saved, '\0'); }
+    ASSERT_EQ(saved.rfind("basic-translator-cache 3 ", 0), 0u);
+    const std::size_t nl = saved.find('\n');
+    saved[nl - 1] = saved[nl - 1] == '0' ? '1' : '0';
+    std::ofstream(path, std::ios::binary) << saved;
+    EXPECT_FALSE(cache.load(path.string()));
+    EXPECT_EQ(cache.size(), 0u);
+
+    // Bozuk dosya boş önbellek olarak yüklenir.
+    std::ofstream(path, std::ios::binary) << "basic-translator-cache 1\nzz\n";
+    EXPECT_FALSE(cache.load(path.string()));
+    EXPECT_EQ(cache.size(), 0u);
+    fs::remove(path);
+}
+
+TEST(Incremental, FallsBackForUnlabeledOrInvalidLines) {
+    TranslationCache cache;
+    const std::string unlabeled = "10 LET X = 1\nPRINT X\n";
+    EXPECT_EQ(cache.translate(unlabeled), full(unlabeled));
+    EXPECT_TRUE(cache.stats().fallback);
+
+    // Hata iletisi tam çeviriden gelir.
+    try { cache.translate("10 FOO\n"); FAIL() << "expected error"; }
+    catch (const std::runtime_error& e) { EXPECT_STREQ(e.what(), "Unknown statement"); }
+}
@@ -0,0 +1,69 @@
+/**
+ * @file test_translator_interner.cpp
+ * @brief Interner, kimlik tabanlı SymbolTable ve parser'ın kimlik ataması için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include "translator/interner.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator/symbol_table.h"
+
+using namespace translator;
+
+TEST(Interner, AssignsDenseIdsInFirstSeenOrder) {
+    Interner in;
+    EXPECT_EQ(in.intern("X"), 0u);
+    EXPECT_EQ(in.intern("TOTAL"), 1u);
+    EXPECT_EQ(in.intern("X"), 0u);
+    EXPECT_EQ(in.size(), 2u);
+    EXPECT_EQ(in.name(1), "TOTAL");
+    EXPECT_EQ(in.find("TOTAL"), 1u);
+    EXPECT_EQ(in.find("MISSING"), Interner::npos);
+}
+
+TEST(Interner, NamesOutliveSourceAndMove) {
+    Interner in;
+    {
+        std::string tmp = "COUNTER";
+        in.intern(tmp);
+        tmp.assign("XXXXXXX");
+    }
+    std::string_view before = in.name(0);
+    Interner moved = std::move(in);
+    EXPECT_EQ(moved.name(0), "COUNTER");
+    EXPECT_EQ(moved.name(0).data(), before.data());
+}
+
+TEST(SymbolTableSlots, DefineAssignLookup) {
+    Interner in; SymbolId a = in.intern("A"), b = in.intern("B");
+    SymbolTable st(in);
+    EXPECT_EQ(st.size(), 2u);
+    EXPECT_EQ(st.lookup(a), nullptr);
+    EXPECT_TRUE(st.define(a, 1.5));
+    EXPECT_FALSE(st.assign(a, 2.5));
+    ASSERT_NE(st.lookup(a), nullptr);
+    EXPECT_DOUBLE_EQ(*st.lookup(a), 2.5);
+    EXPECT_EQ(st.lookup(b), nullptr);
+    EXPECT_TRUE(st.define(7, 1.0));
+    EXPECT_EQ(st.size(), 8u);
+    EXPECT_EQ(st.lookup(5), nullptr);
+}
+
+TEST(ParserSymbols, SameNameSharesIdAcrossStatements) {
+    Lexer lx("10 INPUT N\n20 LET S = S + N\n30 PRINT S, N\n");
+    Parser ps(lx);
+    Program p = ps.parseProgram();
+    ASSERT_EQ(p.symbols.size(), 2u);
+    SymbolId n = p.symbols.find("N"), s = p.symbols.find("S");
+    EXPECT_EQ(static_cast<const InputStmt*>(p.stmts[0])->id, n);
+    auto* let = static_cast<const LetStmt*>(p.stmts[1]);
+    EXPECT_EQ(let->id, s);
+    auto* sum = static_cast<const BinaryExpr*>(let->expr);
+    EXPECT_EQ(static_cast<const VariableExpr*>(sum->lhs)->id, s);
+    EXPECT_EQ(static_cast<const VariableExpr*>(sum->rhs)->id, n);
+    auto* pr = static_cast<const PrintStmt*>(p.stmts[2]);
+    EXPECT_EQ(static_cast<const VariableExpr*>(pr->items[1])->name.data(), p.symbols.name(n).data());
+}
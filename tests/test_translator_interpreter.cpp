@@ -0,0 +1,52 @@
+/**
+ * @file test_translator_interpreter.cpp
+ * @brief Ağaç yürütücü yorumlayıcı için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "translator/interpreter.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator/vm.h"
+#include "translator_run.h"
+
+using namespace translator;
+using translator_test::interpret;
+using translator_test::run_vm;
+
+TEST(Interpreter, EvaluatesAndPrints) {
+    EXPECT_EQ(interpret("10 LET X = 1 + 2 * 3\n20 PRINT X, X / 2, (X - 1) * 2\n"), "73.512\n");
+    EXPECT_EQ(interpret("10 PRINT Y + 1\n"), "1\n");
+    EXPECT_EQ(interpret("10 INPUT A\n20 INPUT B\n30 PRINT A * B\n", "6 7"), "42\n");
+}
+
+TEST(Interpreter, TerminationMatchesGeneratedCode) {
+    EXPECT_EQ(interpret("10 GOTO 50\n20 PRINT 1\n"), "");
+    EXPECT_EQ(interpret("10 PRINT 1\n20 RETURN\n30 PRINT 2\n"), "1\n");
+    EXPECT_EQ(interpret("10 PRINT 1\n20 GOSUB 10\n"), "1\n");
+}
+
+TEST(Interpreter, CountsStatementsAndKeepsVariables) {
+    Lexer lx("10 LET I = 3\n20 LET I = I - 1\n30 IF I THEN 20\n");
+    Parser ps(lx);
+    Program prog = ps.parseProgram();
+    Interpreter it(prog);
+    std::istringstream in;
+    std::ostringstream out;
+    // 1 + 3 * 2
+    EXPECT_EQ(it.run(in, out), 7u);
+    EXPECT_EQ(it.value(prog.symbols.find("I")), 0.0);
+    EXPECT_EQ(it.run(in, out), 7u);
+}
+
+TEST(Interpreter, AgreesWithVm) {
+    const char* const kPrograms[] = {
+        "10 LET I = 5\n20 PRINT I * I\n30 LET I = I - 1\n40 IF I THEN 20\n",
+        "10 LET N = 4\n20 GOSUB 100\n30 PRINT D\n40 GOTO 999\n"
+        "100 IF N THEN 120\n110 RETURN\n120 LET N = N - 1\n130 LET D = D + N\n140 GOSUB 100\n150 RETURN\n",
+        "10 INPUT A\n20 LET B = (A + 1) / (A - 1)\n30 PRINT A, B\n40 IF A - 3 THEN 10\n",
+    };
+    for (const char* src : kPrograms) EXPECT_EQ(interpret(src, "2 5 3"), run_vm(src, "2 5 3")) << src;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file test_translator_keywords.cpp
+ * @brief Derleme zamanlı anahtar sözcük tanıyıcısı için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "translator/keywords.h"
+#include "translator/lexer.h"
+
+using namespace translator;
+
+// Derleme zamanında da kullanılabilmeli
+static_assert(keyword_type("goSub") == TokenType::KW_GOSUB, "keyword_type constexpr olmalı");
+static_assert(keyword_type("X") == TokenType::Identifier, "tek harf anahtar sözcük değildir");
+
+TEST(Keywords, AllKeywordsAnyCase){
+    for (const auto& k : kKeywords){
+        std::string lower(k.text);
+        for (auto& c : lower) c = static_cast<char>(c - 'A' + 'a');
+        EXPECT_EQ(keyword_type(k.text), k.type) << k.text;
+        EXPECT_EQ(keyword_type(lower), k.type) << lower;
+    }
+}
+
+TEST(Keywords, NearMissesAreIdentifiers){
+    for (const char* id : {"LETX", "PRIN", "I", "GOTOS", "RETURNS", "IFF", "TOO", "NEX", "FORM", "THE", "GOSUC", "INPUTS", "A1", "_IF", "STEPS", "STE"}){
+        EXPECT_EQ(keyword_type(id), TokenType::Identifier) << id;
+    }
+}
+
+TEST(Keywords, LexerUsesTable){
+    auto toks = Lexer("for I = 1 to 10\nnext I\n").tokenize_view();
+    EXPECT_EQ(toks[0].type, TokenType::KW_FOR);
+    EXPECT_EQ(toks[1].type, TokenType::Identifier);
+    EXPECT_EQ(toks[4].type, TokenType::KW_TO);
+    EXPECT_EQ(toks[7].type, TokenType::KW_NEXT);
+}
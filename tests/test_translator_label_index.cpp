@@ -0,0 +1,118 @@
+/**
+ * @file test_translator_label_index.cpp
+ * @brief Etiket dizini (LabelIndex) ve dispatch atlama tablosu için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "translator/codegen.h"
+#include "translator/flat_ast.h"
+#include "translator/interpreter.h"
+#include "translator/label_index.h"
+#include "translator/lexer.h"
+#include "translator/optimize.h"
+#include "translator/parser.h"
+#include "translator/vm.h"
+
+using namespace translator;
+
+TEST(LabelIndex, DenseMultiplesAreDirectMapped) {
+    LabelIndex idx({10, 20, 30, 50, 60});
+    EXPECT_TRUE(idx.direct());
+    EXPECT_EQ(idx.size(), 5u);
+    EXPECT_EQ(idx.find(10), 0);
+    EXPECT_EQ(idx.find(50), 3);
+    EXPECT_EQ(idx.find(60), 4);
+    EXPECT_EQ(idx.find(40), LabelIndex::npos);
+    EXPECT_EQ(idx.find(15), LabelIndex::npos);
+    EXPECT_EQ(idx.find(0), LabelIndex::npos);
+    EXPECT_EQ(idx.find(70), LabelIndex::npos);
+    EXPECT_EQ(idx.find(-1), LabelIndex::npos);
+}
+
+TEST(LabelIndex, SparseLabelsUseBinarySearch) {
+    // Etiketler sıralı olmak zorunda değildir.
+    LabelIndex idx({1000, 1, 7, 50000, 3});
+    EXPECT_FALSE(idx.direct());
+    EXPECT_EQ(idx.find(1), 1);
+    EXPECT_EQ(idx.find(3), 4);
+    EXPECT_EQ(idx.find(50000), 3);
+    EXPECT_EQ(idx.find(1000), 0);
+    EXPECT_EQ(idx.find(2), LabelIndex::npos);
+    EXPECT_EQ(idx.find(60000), LabelIndex::npos);
+}
+
+TEST(LabelIndex, DuplicateLabelResolvesToLastStatement) {
+    EXPECT_EQ(LabelIndex({10, 20, 10}).find(10), 2);
+    EXPECT_EQ(LabelIndex({5, 100000, 5, 9}).find(5), 2);
+    EXPECT_EQ(LabelIndex().find(10), LabelIndex::npos);
+    EXPECT_EQ(LabelIndex({42}).find(42), 0);
+}
+
+TEST(LabelIndex, SharedByProgramFlatProgramAndDeadCode) {
+    Lexer lx("10 GOTO 30\n20 PRINT 1\n30 LET X = 1\n40 PRINT X\n");
+    Parser ps(lx);
+    Program prog = ps.parseProgram();
+    EXPECT_EQ(prog.index.find(30), 2);
+    FlatProgram f = flatten(prog);
+    EXPECT_EQ(f.index, prog.index);
+    eliminate_dead_code(f);
+    ASSERT_EQ(f.labels, (std::vector<int>{10, 30, 40}));
+    EXPECT_EQ(f.index.find(30), 1);
+    EXPECT_EQ(f.index.find(20), LabelIndex::npos);
+}
+
+TEST(LabelIndex, MatchesOnlyTheLabelsItWasBuiltFrom) {
+    EXPECT_TRUE(LabelIndex({10, 20, 30}).matches({10, 20, 30}));
+    EXPECT_TRUE(LabelIndex({10, 20, 10}).matches({10, 20, 10}));
+    EXPECT_TRUE(LabelIndex().matches({}));
+    EXPECT_FALSE(LabelIndex().matches({10}));
+    EXPECT_FALSE(LabelIndex({10, 20, 30}).matches({10, 30, 20}));
+    EXPECT_FALSE(LabelIndex({10, 20, 30}).matches({10, 20, 40}));
+}
+
+TEST(LabelIndex, HandBuiltProgramWithoutIndex) {
+    // parseProgram() kullanılmadan kurulan programın dizini boştur.
+    Program p;
+    const SymbolId x = p.symbols.intern("X");
+    const std::string_view name = p.symbols.name(x);
+    Expr* five = p.arena->make<NumberExpr>(5.0);
+    Expr* one = p.arena->make<NumberExpr>(1.0);
+    Expr* read = p.arena->make<VariableExpr>(x, name);
+    p.labels = {10, 20, 30, 40};
+    p.stmts = {
+        p.arena->make<GotoStmt>(30),
+        p.arena->make<PrintStmt>(NodeList<Expr>{p.arena->copy_array(&one, 1), 1}),
+        p.arena->make<LetStmt>(x, name, five),
+        p.arena->make<PrintStmt>(NodeList<Expr>{p.arena->copy_array(&read, 1), 1}),
+    };
+
+    Lexer lx("10 GOTO 30\n20 PRINT 1\n30 LET X = 5\n40 PRINT X\n");
+    const Program parsed = Parser(lx).parseProgram();
+    EXPECT_EQ(flatten(p).index, parsed.index);
+    for (ControlFlow flow : {ControlFlow::Dispatch, ControlFlow::Blocks, ControlFlow::Structured}){
+        CodegenOptions opts; opts.flow = flow;
+        EXPECT_EQ(Codegen::emit_cpp(p, opts), Codegen::emit_cpp(parsed, opts));
+    }
+    std::istringstream in; std::ostringstream a, b;
+    Interpreter(p).run(in, a);
+    EXPECT_EQ(a.str(), "5\n");
+    // Düz programda bayatlayan dizin de yok sayılır.
+    FlatProgram f = flatten(parsed);
+    f.index = LabelIndex();
+    VM(compile_bytecode(f)).run(in, b);
+    EXPECT_EQ(b.str(), "5\n");
+}
+
+TEST(LabelIndex, DispatchSwitchesOnStatementNumbers) {
+    Lexer lx("10 GOSUB 30\n20 GOTO 99\n30 RETURN\n");
+    Parser ps(lx);
+    std::string code = Codegen::emit_cpp(ps.parseProgram());
+    EXPECT_NE(code.find("  enum : int { L10, L20, L30, END, L99 = END };\n"), std::string::npos) << code;
+    EXPECT_NE(code.find("  int pc = L10;\n"), std::string::npos) << code;
+    EXPECT_NE(code.find("    case L30: {\n"), std::string::npos) << code;
+    EXPECT_NE(code.find("call.push(L20); pc = L30;"), std::string::npos) << code;
+    EXPECT_NE(code.find("pc = L99; break;"), std::string::npos) << code;
+}
@@ -0,0 +1,275 @@
+/**
+ * @file test_translator_optimize.cpp
+ * @brief Sabit katlama, sadeleştirme, blok içi sabit yayılımı ve ölü kod eleme için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "translator/codegen.h"
+#include "translator/flat_ast.h"
+#include "translator/interpreter.h"
+#include "translator/lexer.h"
+#include "translator/optimize.h"
+#include "translator/parser.h"
+#include "translator/vm.h"
+#include "translator_run.h"
+
+using namespace translator;
+using translator_test::flat_of;
+
+namespace {
+
+/// Eniyilenmiş programın slot kipindeki C++ çıktısı.
+std::string optimized(const std::string& src, OptimizeStats* stats = nullptr){
+    FlatProgram f = flat_of(src);
+    OptimizeStats s = optimize(f);
+    if (stats) *stats = s;
+    CodegenOptions o; o.vars = VarStorage::Slots;
+    return Codegen::emit_cpp(f, o);
+}
+
+/// Ölü kod elemesinden sonra kalan programı döndürür.
+FlatProgram without_dead_code(const std::string& src, DeadCodeStats* stats = nullptr){
+    FlatProgram f = flat_of(src);
+    DeadCodeStats s = eliminate_dead_code(f);
+    if (stats) *stats = s;
+    return f;
+}
+
+} // namespace
+
+TEST(Optimize, FoldsConstantExpressions) {
+    OptimizeStats st;
+    std::string code = optimized("10 LET X = 2 * 3 + 4\n", &st);
+    EXPECT_NE(code.find("slots[0] = 10.0;"), std::string::npos) << code;
+    EXPECT_EQ(st.folded, 2u);
+    EXPECT_EQ(st.nodes_before, 5u);
+    EXPECT_EQ(st.nodes_after, 1u);
+    EXPECT_EQ(st.eliminated(), 4u);
+}
+
+TEST(Optimize, FoldedValuesRoundTrip) {
+    std::string code = optimized("10 LET X = 1 / 3\n");
+    EXPECT_NE(code.find("slots[0] = 0.3333333333333333;"), std::string::npos) << code;
+}
+
+TEST(Optimize, DivisionByZeroIsNotFolded) {
+    OptimizeStats st;
+    std::string code = optimized("10 LET X = 1 / 0\n", &st);
+    EXPECT_NE(code.find("slots[0] = (1.0 / 0.0);"), std::string::npos) << code;
+    EXPECT_EQ(st.folded, 0u);
+    EXPECT_EQ(st.eliminated(), 0u);
+}
+
+TEST(Optimize, AlgebraicIdentities) {
+    OptimizeStats st;
+    std::string code = optimized(
+        "10 INPUT A\n"
+        "20 PRINT A - 0, A * 1, 1 * A, A / 1\n"
+        "30 PRINT A - 2\n", &st);
+    EXPECT_NE(code.find("std::cout << slots[0] << slots[0] << slots[0] << slots[0] << std::endl;"), std::string::npos) << code;
+    EXPECT_NE(code.find("std::cout << (slots[0] - 2.0) << std::endl;"), std::string::npos) << code;
+    EXPECT_EQ(st.simplified, 4u);
+    EXPECT_EQ(st.folded, 0u);
+    // Kalan düğümler: dört A, A - 2 için üç düğüm.
+    EXPECT_EQ(st.nodes_after, 7u);
+}
+
+TEST(Optimize, IdentitiesThatChangeSpecialValuesAreKept) {
+    // -0 + 0 = 0 ve NaN - NaN = NaN: bu ifadeler sadeleştirilirse çıktı değişir.
+    OptimizeStats st;
+    std::string code = optimized(
+        "10 LET A = 1 / 0\n"
+        "20 LET B = A - A\n"
+        "30 INPUT J\n"
+        "40 LET Z = -J * 0\n"
+        "50 PRINT B, Z + 0, 0 + Z\n", &st);
+    EXPECT_NE(code.find("slots[1] = (slots[0] - slots[0]);"), std::string::npos) << code;
+    EXPECT_NE(code.find("std::cout << slots[1] << (slots[3] + 0.0) << (0.0 + slots[3]) << std::endl;"), std::string::npos) << code;
+    EXPECT_EQ(st.simplified, 0u);
+}
+
+TEST(Optimize, PropagatesConstantsWithinBlock) {
+    OptimizeStats st;
+    std::string code = optimized(
+        "10 LET X = 5\n"
+        "20 LET Y = X * 2\n"
+        "30 PRINT X + Y\n", &st);
+    EXPECT_NE(code.find("slots[1] = 10.0;"), std::string::npos) << code;
+    EXPECT_NE(code.find("std::cout << 15.0 << std::endl;"), std::string::npos) << code;
+    EXPECT_EQ(st.propagated, 3u);
+}
+
+TEST(Optimize, InputAndNonConstantLetStopPropagation) {
+    std::string code = optimized(
+        "10 LET X = 5\n"
+        "20 INPUT X\n"
+        "30 PRINT X\n"
+        "40 LET Y = 1\n"
+        "50 LET Y = X\n"
+        "60 PRINT Y\n");
+    EXPECT_NE(code.find("std::cout << slots[0] << std::endl;"), std::string::npos) << code;
+    EXPECT_NE(code.find("std::cout << slots[1] << std::endl;"), std::string::npos) << code;
+}
+
+TEST(Optimize, BlockLeadersResetConstants) {
+    std::string code = optimized(
+        "10 LET X = 1\n"
+        "20 PRINT X\n"
+        "30 LET X = X + 1\n"
+        "40 IF 5 - X THEN 20\n");
+    // 20 bir atlama hedefidir: X orada bilinmez.
+    EXPECT_NE(code.find("std::cout << slots[0] << std::endl;"), std::string::npos) << code;
+    EXPECT_NE(code.find("slots[0] = (slots[0] + 1.0);"), std::string::npos) << code;
+}
+
+TEST(Optimize, CodegenOptionMatchesExplicitPass) {
+    const std::string src = "10 LET X = 2 * 3\n20 PRINT X * 1\n";
+    Lexer lx(src);
+    Parser ps(lx);
+    CodegenOptions o; o.vars = VarStorage::Slots; o.optimize = true;
+    FlatProgram f = flat_of(src);
+    optimize(f);
+    eliminate_dead_code(f);
+    CodegenOptions plain; plain.vars = VarStorage::Slots;
+    std::string code = Codegen::emit_cpp(ps.parseProgram(), o);
+    EXPECT_EQ(code, Codegen::emit_cpp(f, plain));
+    // X sabit olarak yayıldığı için LET'i ölüdür.
+    EXPECT_EQ(code.find("slots[0] ="), std::string::npos) << code;
+    EXPECT_NE(code.find("std::cout << 6.0 << std::endl;"), std::string::npos) << code;
+}
+
+TEST(Optimize, ExpressionArraysStayPostOrder) {
+    FlatProgram f = flat_of("10 INPUT A\n20 LET B = (A + 0) * (2 + 3) - A * 1\n30 PRINT B, 1 + 1\n");
+    optimize(f);
+    for (std::size_t e = 0; e < f.expr_kind.size(); ++e) {
+        if (f.expr_kind[e] != ExprKind::Binary) continue;
+        EXPECT_LT(f.expr_a[e], static_cast<NodeIndex>(e));
+        EXPECT_LT(f.expr_b[e], static_cast<NodeIndex>(e));
+    }
+    EXPECT_EQ(f.numbers.size(), 3u);   // 0, 5 ve 2
+}
+
+TEST(DeadCode, RemovesCodeAfterGotoAndUncalledSubroutines) {
+    DeadCodeStats st;
+    FlatProgram f = without_dead_code(
+        "10 INPUT A\n"
+        "20 GOTO 50\n"
+        "30 PRINT A\n"
+        "40 GOTO 20\n"
+        "50 PRINT A\n"
+        "60 GOTO 90\n"
+        "70 PRINT 1\n"
+        "80 RETURN\n"
+        "90 PRINT 2\n", &st);
+    EXPECT_EQ(f.labels, (std::vector<int>{10, 20, 50, 60, 90}));
+    EXPECT_EQ(st.stmts_before, 9u);
+    EXPECT_EQ(st.unreachable, 4u);
+    EXPECT_EQ(st.dead_stores, 0u);
+    // Silinen PRINT'lerin ifadeleri de gider; kalanlar: A, 2.
+    EXPECT_EQ(f.expr_kind.size(), 2u);
+    EXPECT_EQ(f.items.size(), 2u);
+}
+
+TEST(DeadCode, KeepsCalledSubroutinesAndReturnSites) {
+    DeadCodeStats st;
+    FlatProgram f = without_dead_code(
+        "10 GOSUB 40\n"
+        "20 PRINT X\n"
+        "30 GOTO 60\n"
+        "40 LET X = 7\n"
+        "50 RETURN\n"
+        "60 PRINT 0\n", &st);
+    EXPECT_EQ(st.removed(), 0u);
+    EXPECT_EQ(f.size(), 6u);
+}
+
+TEST(DeadCode, RemovesOverwrittenAndUnreadLets) {
+    DeadCodeStats st;
+    FlatProgram f = without_dead_code(
+        "10 LET X = 1\n"
+        "20 LET Y = X + 1\n"
+        "30 LET X = 2\n"
+        "40 LET Z = X\n"
+        "50 PRINT X\n", &st);
+    // 10 okunur (20) ama 20 ölüdür; güçlü canlılıkla 10 da düşer. 40 hiç okunmaz.
+    EXPECT_EQ(f.labels, (std::vector<int>{30, 50}));
+    EXPECT_EQ(st.dead_stores, 3u);
+    EXPECT_EQ(st.unreachable, 0u);
+}
+
+TEST(DeadCode, LoopCarriedValuesStayLive) {
+    DeadCodeStats st;
+    FlatProgram f = without_dead_code(
+        "10 LET I = 3\n"
+        "20 PRINT I\n"
+        "30 LET I = I - 1\n"
+        "40 IF I THEN 20\n"
+        "50 LET I = 9\n", &st);
+    EXPECT_EQ(f.labels, (std::vector<int>{10, 20, 30, 40}));
+    EXPECT_EQ(st.dead_stores, 1u);
+}
+
+TEST(DeadCode, ValuesReadAfterReturnStayLive) {
+    DeadCodeStats st;
+    without_dead_code(
+        "10 GOSUB 40\n"
+        "20 PRINT R\n"
+        "30 GOTO 99\n"
+        "40 LET R = 5\n"
+        "50 RETURN\n"
+        "99 PRINT 0\n", &st);
+    EXPECT_EQ(st.removed(), 0u);
+}
+
+TEST(DeadCode, JumpsToRemovedLetsAreRetargeted) {
+    FlatProgram f = without_dead_code(
+        "10 INPUT A\n"
+        "20 IF A THEN 40\n"
+        "30 PRINT A\n"
+        "40 LET B = 1\n"
+        "50 PRINT A\n"
+        "60 GOTO 80\n"
+        "70 PRINT B\n"
+        "80 LET C = 2\n");
+    ASSERT_EQ(f.labels, (std::vector<int>{10, 20, 30, 50, 60}));
+    EXPECT_EQ(f.stmt_a[1], 50);
+    EXPECT_EQ(f.stmt_a[4], -1);
+    std::string code = Codegen::emit_cpp(f);
+    EXPECT_NE(code.find("if (var[\"A\"]) pc = L50;"), std::string::npos) << code;
+    EXPECT_NE(code.find("pc = END; break;"), std::string::npos) << code;
+}
+
+TEST(DeadCode, KeepsReturnSiteOfTrailingGosub) {
+    DeadCodeStats st;
+    FlatProgram f = without_dead_code(
+        "10 PRINT 1\n"
+        "20 IF 0 THEN 50\n"
+        "30 GOSUB 10\n"
+        "40 LET A = 2\n", &st);
+    // 40 okunmaz ama 30'un dönüş noktasıdır: silinirse GOSUB son deyim olup programı bitirirdi.
+    EXPECT_EQ(f.labels, (std::vector<int>{10, 20, 30, 40}));
+    EXPECT_EQ(st.dead_stores, 0u);
+}
+
+TEST(Optimize, IntegralLiteralsStayDoubleInEveryMode) {
+    // C++'ta `7 / 2` tamsayı bölmesidir; BASIC'te ve katlanmış sabitte 3.5'tir.
+    Lexer lx("10 PRINT 7 / 2, 1234567\n");
+    const Program p = Parser(lx).parseProgram();
+    for (VarStorage v : {VarStorage::Map, VarStorage::Slots, VarStorage::Locals}){
+        for (ControlFlow fl : {ControlFlow::Dispatch, ControlFlow::Blocks, ControlFlow::Structured}){
+            CodegenOptions o; o.vars = v; o.flow = fl;
+            std::string code = Codegen::emit_cpp(p, o);
+            EXPECT_NE(code.find("std::cout << (7.0 / 2.0) << 1234567.0 << std::endl;"), std::string::npos) << code;
+            o.optimize = true;
+            code = Codegen::emit_cpp(p, o);
+            EXPECT_NE(code.find("std::cout << 3.5 << 1234567.0 << std::endl;"), std::string::npos) << code;
+        }
+    }
+    std::istringstream in; std::ostringstream interp, vm;
+    Interpreter(p).run(in, interp);
+    VM(compile_bytecode(p)).run(in, vm);
+    EXPECT_EQ(interp.str(), "3.51.23457e+06\n");
+    EXPECT_EQ(vm.str(), interp.str());
+}
@@ -0,0 +1,150 @@
+/**
+ * @file test_translator_pipeline.cpp
+ * @brief Deyim deyim çözümleme (parse_each) ve akışlı kod üretimi için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "translator/arena.h"
+#include "translator/codegen.h"
+#include "translator/emitter.h"
+#include "translator/flat_ast.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator_run.h"
+
+namespace fs = std::filesystem;
+using namespace translator;
+using translator_test::read_file;
+
+namespace {
+
+const char* kProgram =
+    "10 LET X = 1\n"
+    "20 PRINT X, X * 2 + 1\n"
+    "30 IF X - 3 THEN 50\n"
+    "40 GOSUB 100\n"
+    "50 LET X = X + 1\n"
+    "60 GOTO 30\n"
+    "100 RETURN\n";
+
+std::string stream_translate(const std::string& src){
+    Lexer lx(src);
+    Parser ps(lx);
+    Emitter out;
+    StreamCodegen gen(out);
+    auto errors = ps.parse_each([&](int label, const Stmt* st, const Interner& symbols){ gen.statement(label, st, symbols); });
+    EXPECT_TRUE(errors.empty());
+    gen.finish();
+    return out.take();
+}
+
+} // namespace
+
+TEST(Pipeline, ArenaResetReusesLastBlock){
+    Arena a;
+    for (int i = 0; i < 100000; ++i) a.make<double>(1.0);
+    EXPECT_GT(a.block_count(), 1u);
+    a.reset();
+    EXPECT_EQ(a.block_count(), 1u);
+    EXPECT_EQ(a.bytes_used(), 0u);
+    double* d = a.make<double>(2.5);
+    EXPECT_EQ(*d, 2.5);
+    EXPECT_EQ(a.block_count(), 1u);
+}
+
+TEST(Pipeline, ParseEachMatchesParse){
+    Lexer whole(kProgram);
+    Program p = Parser(whole).parseProgram();
+
+    Lexer lx(kProgram);
+    std::vector<int> labels;
+    std::vector<StmtKind> kinds;
+    auto errors = Parser(lx).parse_each([&](int label, const Stmt* st, const Interner&){
+        labels.push_back(label);
+        kinds.push_back(st->kind());
+    });
+    EXPECT_TRUE(errors.empty());
+    EXPECT_EQ(labels, p.labels);
+    ASSERT_EQ(kinds.size(), p.stmts.size());
+    for (std::size_t i = 0; i < kinds.size(); ++i) EXPECT_EQ(kinds[i], p.stmts[i]->kind());
+}
+
+TEST(Pipeline, ParseEachReportsSameErrors){
+    const char* src = "10 LET X = (1\n20 PRINT X\n30 FOO\n40 GOTO 10\n";
+    Lexer whole(src);
+    ParseResult r = Parser(whole).parse();
+
+    Lexer lx(src);
+    std::vector<int> labels;
+    auto errors = Parser(lx).parse_each([&](int label, const Stmt*, const Interner&){ labels.push_back(label); });
+    ASSERT_EQ(errors.size(), r.errors.size());
+    for (std::size_t i = 0; i < errors.size(); ++i){
+        EXPECT_EQ(errors[i].line, r.errors[i].line);
+        EXPECT_EQ(errors[i].column, r.errors[i].column);
+        EXPECT_EQ(errors[i].message, r.errors[i].message);
+    }
+    EXPECT_EQ(labels, (std::vector<int>{20, 40}));
+}
+
+TEST(Pipeline, AppendStmtMatchesFlatten){
+    Lexer lx(kProgram);
+    Program p = Parser(lx).parseProgram();
+    FlatProgram whole = flatten(p);
+    FlatProgram step;
+    for (std::size_t i = 0; i < p.stmts.size(); ++i) append_stmt(step, p.labels[i], p.stmts[i]);
+    EXPECT_EQ(step.labels, whole.labels);
+    EXPECT_EQ(step.stmt_kind, whole.stmt_kind);
+    EXPECT_EQ(step.stmt_a, whole.stmt_a);
+    EXPECT_EQ(step.stmt_b, whole.stmt_b);
+    EXPECT_EQ(step.items, whole.items);
+    EXPECT_EQ(step.expr_kind, whole.expr_kind);
+    EXPECT_EQ(step.expr_op, whole.expr_op);
+    EXPECT_EQ(step.numbers, whole.numbers);
+}
+
+TEST(Pipeline, StreamCodegenUsesNumericLabels){
+    std::string code = stream_translate(kProgram);
+    EXPECT_NE(code.find("int pc = 10;"), std::string::npos);
+    EXPECT_NE(code.find("case 10:"), std::string::npos);
+    EXPECT_NE(code.find("case 100:"), std::string::npos);
+    EXPECT_NE(code.find("pc = 20;"), std::string::npos);
+    EXPECT_NE(code.find("var[\"X\"]"), std::string::npos);
+    EXPECT_EQ(code.find("enum"), std::string::npos);
+    EXPECT_NE(code.find("int main"), std::string::npos);
+}
+
+TEST(Pipeline, StreamCodegenEmptyProgram){
+    std::string code = stream_translate("");
+    EXPECT_NE(code.find("int main"), std::string::npos);
+    EXPECT_NE(code.find("return 0;"), std::string::npos);
+    EXPECT_EQ(code.find("switch"), std::string::npos);
+}
+
+TEST(Pipeline, StreamCodegenFlushesBeforeEnd){
+    std::string src;
+    for (int i = 1; i <= 2000; ++i) src += std::to_string(i * 10) + " PRINT X, " + std::to_string(i) + "\n";
+    const std::string path = (fs::temp_directory_path() / "translator_pipeline_test.cpp").string();
+    std::size_t before_finish = 0;
+    {
+        Emitter out = Emitter::open(path, 1024);
+        StreamCodegen gen(out);
+        Lexer lx(src);
+        auto errors = Parser(lx).parse_each([&](int label, const Stmt* st, const Interner& symbols){ gen.statement(label, st, symbols); });
+        EXPECT_TRUE(errors.empty());
+        before_finish = out.flushed();
+        gen.finish();
+        EXPECT_TRUE(out.flush());
+    }
+    EXPECT_GT(before_finish, 0u);
+    Lexer lx(src);
+    Parser ps(lx);
+    Emitter mem;
+    StreamCodegen gen(mem);
+    ps.parse_each([&](int label, const Stmt* st, const Interner& symbols){ gen.statement(label, st, symbols); });
+    gen.finish();
+    EXPECT_EQ(read_file(path), mem.take());
+    fs::remove(path);
+}
@@ -0,0 +1,86 @@
+/**
+ * @file test_translator_scan.cpp
+ * @brief SIMD tarama çekirdekleri için skaler sürüme karşı farksal testler.
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "translator/lexer.h"
+#include "translator/scan.h"
+
+using namespace translator;
+
+namespace {
+
+/// Tüm desteklenen komut kümeleri.
+std::vector<scan::Isa> supported_isas(){
+    std::vector<scan::Isa> out;
+    for (auto isa : {scan::Isa::Scalar, scan::Isa::SSE2, scan::Isa::AVX2}) if (scan::supported(isa)) out.push_back(isa);
+    return out;
+}
+
+/// Uzun tanımlayıcı, sayı, dize ve boşluk dizileri içeren rastgele kaynak üretir.
+std::string random_source(unsigned seed, std::size_t len){
+    static const char kAlphabet[] = "abcXYZ_09 \t\r\n\"+-*/=(),@\x80\xff";
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<std::size_t> pick(0, sizeof(kAlphabet) - 2), run(1, 70);
+    std::string s;
+    while (s.size() < len){
+        char c = kAlphabet[pick(rng)];
+        s.append(run(rng) % 3 == 0 ? run(rng) : 1, c);
+    }
+    return s;
+}
+
+/// Etkin seçimi test sonunda geri yükler.
+struct RestoreIsa { scan::Isa isa = scan::active().isa; ~RestoreIsa(){ scan::select(isa); } };
+
+} // namespace
+
+TEST(ScanKernels, MatchScalarAtEveryOffset){
+    const std::string src = std::string(40, '7') + "  \t\r  \n" + std::string(37, 'a') + "_Z9" + "\"" + std::string(33, '\n') + "x\"";
+    const auto& ref = scan::kernels_for(scan::Isa::Scalar);
+    for (auto isa : supported_isas()){
+        const auto& k = scan::kernels_for(isa);
+        for (std::size_t i = 0; i <= src.size(); ++i){
+            const char* p = src.data(); std::size_t n = src.size();
+            EXPECT_EQ(k.skip_digits(p, i, n), ref.skip_digits(p, i, n)) << i;
+            EXPECT_EQ(k.skip_ident(p, i, n), ref.skip_ident(p, i, n)) << i;
+            EXPECT_EQ(k.skip_blanks(p, i, n), ref.skip_blanks(p, i, n)) << i;
+            int a = 0, b = 0;
+            EXPECT_EQ(k.find_quote(p, i, n, a), ref.find_quote(p, i, n, b)) << i;
+            EXPECT_EQ(a, b) << i;
+        }
+    }
+}
+
+TEST(ScanKernels, LexerOutputIdenticalAcrossIsas){
+    RestoreIsa restore;
+    for (unsigned seed = 1; seed <= 20; ++seed){
+        Lexer lx(random_source(seed, 4000));
+        ASSERT_TRUE(scan::select(scan::Isa::Scalar));
+        auto expected = lx.tokenize_view();
+        for (auto isa : supported_isas()){
+            ASSERT_TRUE(scan::select(isa));
+            auto got = lx.tokenize_view();
+            ASSERT_EQ(got.size(), expected.size()) << "seed " << seed;
+            for (std::size_t i = 0; i < got.size(); ++i){
+                EXPECT_EQ(got[i].type, expected[i].type);
+                EXPECT_EQ(got[i].lexeme.data(), expected[i].lexeme.data());
+                EXPECT_EQ(got[i].lexeme.size(), expected[i].lexeme.size());
+                EXPECT_EQ(got[i].line, expected[i].line);
+            }
+        }
+    }
+}
+
+TEST(ScanKernels, CharClassesAreLocaleFree){
+    EXPECT_TRUE(scan::is('\r', scan::Blank));
+    EXPECT_FALSE(scan::is('\n', scan::Blank));
+    EXPECT_TRUE(scan::is('_', scan::IdentStart));
+    EXPECT_FALSE(scan::is('5', scan::IdentStart));
+    EXPECT_TRUE(scan::is('5', scan::IdentChar));
+    EXPECT_FALSE(scan::is('\xe7', scan::IdentChar));
+}
@@ -0,0 +1,81 @@
+/**
+ * @file test_translator_source.cpp
+ * @brief SourceBuffer (mmap / read) ve Lexer::next için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator/source.h"
+
+using namespace translator;
+
+namespace {
+
+/// Test süresince var olan geçici kaynak dosyası.
+struct TempSource {
+    std::string path = "temp_translator_source_test.bas";
+    explicit TempSource(const std::string& text){ std::ofstream(path, std::ios::binary) << text; }
+    ~TempSource(){ std::remove(path.c_str()); }
+};
+
+const char* kProgram = "10 LET X = 1 + 2\n20 PRINT X\n30 GOTO 10\n";
+
+} // namespace
+
+TEST(SourceBuffer, MapAndReadYieldSameBytes){
+    TempSource f(kProgram);
+    auto mapped = SourceBuffer::open(f.path, SourceMode::Map);
+    auto read = SourceBuffer::open(f.path, SourceMode::Read);
+    EXPECT_TRUE(mapped.mapped());
+    EXPECT_FALSE(read.mapped());
+    EXPECT_EQ(mapped.view(), kProgram);
+    EXPECT_EQ(read.view(), kProgram);
+}
+
+TEST(SourceBuffer, AutoReadsSmallFilesAndEmptyFiles){
+    TempSource small(kProgram);
+    EXPECT_FALSE(SourceBuffer::open(small.path).mapped());
+    TempSource empty("");
+    auto b = SourceBuffer::open(empty.path, SourceMode::Map);
+    EXPECT_FALSE(b.mapped());
+    EXPECT_TRUE(b.view().empty());
+}
+
+TEST(SourceBuffer, MoveKeepsMapping){
+    TempSource f(kProgram);
+    auto a = SourceBuffer::open(f.path, SourceMode::Map);
+    const char* p = a.view().data();
+    SourceBuffer b = std::move(a);
+    EXPECT_EQ(b.view().data(), p);
+    EXPECT_TRUE(a.view().empty());
+}
+
+TEST(SourceBuffer, MissingFileThrows){
+    EXPECT_THROW((void)SourceBuffer::open("no_such_dir/missing.bas"), std::runtime_error);
+}
+
+TEST(SourceBuffer, LexerScansBufferInPlace){
+    TempSource f(kProgram);
+    auto src = SourceBuffer::open(f.path, SourceMode::Map);
+    Lexer lx(src);
+    auto toks = lx.tokenize_view();
+    ASSERT_GT(toks.size(), 2u);
+    EXPECT_EQ(toks[0].lexeme.data(), src.view().data());
+    Parser ps(lx);
+    EXPECT_EQ(ps.parseProgram().stmts.size(), 3u);
+}
+
+TEST(SourceBuffer, LexerNextMatchesTokenizeView){
+    Lexer lx(kProgram);
+    for (const auto& e : lx.tokenize_view()){
+        auto t = lx.next();
+        EXPECT_EQ(t.type, e.type);
+        EXPECT_EQ(t.lexeme.data(), e.lexeme.data());
+        EXPECT_EQ(t.line, e.line);
+    }
+    EXPECT_EQ(lx.next().type, TokenType::Eof);
+}
@@ -0,0 +1,147 @@
+/**
+ * @file test_translator_structure.cpp
+ * @brief Yapısal kontrol akışı çıkarımı ve yapısal kod üretimi için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "translator/codegen.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator/structure.h"
+#include "translator_run.h"
+
+using namespace translator;
+using translator_test::flat_of;
+
+namespace {
+
+/// Kaynağı yapısal kipte C++'a çevirir.
+std::string structured(const std::string& src){
+    CodegenOptions opts; opts.flow = ControlFlow::Structured; opts.vars = VarStorage::Slots;
+    return Codegen::emit_cpp(flat_of(src), opts);
+}
+
+const char* const kLoopWithDiamond =
+    "10 LET I = 5\n"
+    "20 IF I - 3 THEN 50\n"
+    "30 PRINT 1\n"
+    "40 GOTO 60\n"
+    "50 PRINT 2\n"
+    "60 LET I = I - 1\n"
+    "70 IF I THEN 20\n"
+    "80 PRINT I\n";
+
+} // namespace
+
+TEST(Structure, FindsLoopAndDiamond) {
+    FlatProgram p = flat_of(kLoopWithDiamond);
+    Structure st = recover_structure(p, build_cfg(p));
+    ASSERT_EQ(st.regions.size(), 2u);
+    EXPECT_EQ(st.regions[0].kind, RegionKind::Loop);
+    EXPECT_EQ(st.regions[0].begin, 1);
+    EXPECT_EQ(st.regions[0].end, 6);
+    EXPECT_EQ(st.regions[1].kind, RegionKind::IfElse);
+    EXPECT_EQ(st.regions[1].begin, 1);
+    EXPECT_EQ(st.regions[1].split, 4);
+    EXPECT_EQ(st.regions[1].end, 4);
+    EXPECT_EQ(st.loop_of[3], 0);
+    EXPECT_EQ(st.loop_of[7], -1);
+    EXPECT_EQ(st.leaders, (std::vector<int>{0, 1, 2, 4, 5, 7}));
+}
+
+TEST(Structure, CrossingRegionsFallBackToJumps) {
+    // 20'deki IF, 40-60 döngüsünün ortasına atlar; ikisi iç içe olamaz.
+    FlatProgram p = flat_of(
+        "10 LET I = 3\n"
+        "20 IF I - 3 THEN 50\n"
+        "30 PRINT 1\n"
+        "40 PRINT 2\n"
+        "50 LET I = I - 1\n"
+        "60 IF I THEN 40\n");
+    Structure st = recover_structure(p, build_cfg(p));
+    ASSERT_EQ(st.regions.size(), 1u);
+    EXPECT_EQ(st.regions[0].kind, RegionKind::If);
+    std::string code = structured(
+        "10 LET I = 3\n"
+        "20 IF I - 3 THEN 50\n"
+        "30 PRINT 1\n"
+        "40 PRINT 2\n"
+        "50 LET I = I - 1\n"
+        "60 IF I THEN 40\n");
+    EXPECT_NE(code.find("goto L40;"), std::string::npos);
+    EXPECT_NE(code.find(" L40:;"), std::string::npos);
+}
+
+TEST(StructuredCodegen, EmitsWhileAndIfElseWithoutDispatch) {
+    std::string code = structured(kLoopWithDiamond);
+    EXPECT_EQ(code.find("switch(pc)"), std::string::npos);
+    EXPECT_EQ(code.find("goto"), std::string::npos);
+    EXPECT_EQ(code.find("std::stack"), std::string::npos);
+    EXPECT_NE(code.find("while (true) {\n    if (!((slots[0] - 3.0))) {\n      std::cout << 1.0 << std::endl;\n    } else {\n      std::cout << 2.0 << std::endl;\n    }\n"), std::string::npos);
+    EXPECT_NE(code.find("    if (!(slots[0])) break;\n  }\n"), std::string::npos);
+}
+
+TEST(StructuredCodegen, LoopExitsBecomeBreakAndContinue) {
+    std::string code = structured(
+        "10 LET I = I + 1\n"
+        "20 IF 10 - I THEN 40\n"
+        "30 GOTO 70\n"
+        "40 IF I - 5 THEN 60\n"
+        "50 GOTO 10\n"
+        "60 GOTO 10\n"
+        "70 PRINT I\n");
+    EXPECT_NE(code.find("break;"), std::string::npos);
+    EXPECT_NE(code.find("continue;"), std::string::npos);
+    EXPECT_EQ(code.find("goto"), std::string::npos);
+}
+
+TEST(StructuredCodegen, GosubReturnsThroughSharedSwitch) {
+    std::string code = structured(
+        "10 GOSUB 100\n"
+        "20 GOSUB 100\n"
+        "30 GOTO 200\n"
+        "100 PRINT 1\n"
+        "110 RETURN\n"
+        "200 PRINT 2\n");
+    EXPECT_NE(code.find("call.push(0); goto L100;"), std::string::npos);
+    EXPECT_NE(code.find(" ret_1:;"), std::string::npos);
+    EXPECT_NE(code.find("goto do_return;"), std::string::npos);
+    EXPECT_NE(code.find("      case 1: goto ret_1;\n"), std::string::npos);
+}
+
+TEST(StructuredCodegen, UnknownTargetsExit) {
+    std::string code = structured("10 IF 1 THEN 999\n20 GOTO 999\n30 RETURN\n");
+    EXPECT_NE(code.find("if (1.0) return 0;"), std::string::npos);
+    EXPECT_EQ(code.find("do_return"), std::string::npos);
+}
+
+TEST(Structure, BasicBlocksHaveNoRegions) {
+    FlatProgram p = flat_of(kLoopWithDiamond);
+    Structure st = find_basic_blocks(p, build_cfg(p));
+    EXPECT_TRUE(st.regions.empty());
+    EXPECT_EQ(st.leaders, (std::vector<int>{0, 1, 2, 4, 5, 7}));
+    EXPECT_EQ(st.target[1], 4);
+    EXPECT_EQ(st.target[6], 1);
+    for (int l : st.loop_of) EXPECT_EQ(l, -1);
+}
+
+TEST(BlocksCodegen, FallsThroughInsideBlocksAndJumpsBetweenThem) {
+    CodegenOptions opts; opts.flow = ControlFlow::Blocks; opts.vars = VarStorage::Slots;
+    std::string code = Codegen::emit_cpp(flat_of(kLoopWithDiamond), opts);
+    EXPECT_EQ(code.find("switch(pc)"), std::string::npos);
+    EXPECT_EQ(code.find("while"), std::string::npos);
+    EXPECT_EQ(code.find("std::stack"), std::string::npos);
+    EXPECT_NE(code.find(" L20:;\n  if ((slots[0] - 3.0)) goto L50;\n  std::cout << 1.0 << std::endl;\n  goto L60;\n"), std::string::npos);
+    EXPECT_NE(code.find("  if (slots[0]) goto L20;\n  std::cout << slots[0] << std::endl;\n  return 0;\n}"), std::string::npos);
+    // Hedef olmayan blok başları etiket almaz.
+    EXPECT_EQ(code.find("L30"), std::string::npos);
+}
+
+TEST(BlocksCodegen, GosubKeepsReturnSwitch) {
+    CodegenOptions opts; opts.flow = ControlFlow::Blocks;
+    std::string code = Codegen::emit_cpp(flat_of("10 GOSUB 30\n20 GOTO 50\n30 PRINT 1\n40 RETURN\n50 PRINT 2\n"), opts);
+    EXPECT_NE(code.find("call.push(0); goto L30;"), std::string::npos);
+    EXPECT_NE(code.find("      case 0: goto ret_0;\n"), std::string::npos);
+    EXPECT_EQ(code.find("switch(pc)"), std::string::npos);
+}
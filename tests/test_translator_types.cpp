@@ -0,0 +1,243 @@
+/**
+ * @file test_translator_types.cpp
+ * @brief Tamsayı / double tür çıkarımı ve türlü kod üretimi için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "translator/codegen.h"
+#include "translator/flat_ast.h"
+#include "translator/lexer.h"
+#include "translator/optimize.h"
+#include "translator/parser.h"
+#include "translator/types.h"
+#include "translator_run.h"
+
+using namespace translator;
+using translator_test::compile_and_run;
+using translator_test::flat_of;
+using translator_test::have_compiler;
+
+namespace {
+
+/// Adı verilen değişkenin çıkarılan türü.
+ValueType var_type(const FlatProgram& p, const TypeInfo& t, const std::string& name){
+    for (std::size_t i = 0; i < p.names.size(); ++i) if (p.names[i] == name) return t.vars[i];
+    ADD_FAILURE() << "no variable " << name;
+    return ValueType::Double;
+}
+
+} // namespace
+
+TEST(Types, IntegerLiteralsAndArithmeticStayInt){
+    FlatProgram p = flat_of("10 LET I = 10\n20 LET S = I * 2 - 1\n30 LET J = S - I\n40 IF J > 0 THEN 20\n");
+    TypeInfo t = infer_types(p);
+    EXPECT_EQ(var_type(p, t, "I"), ValueType::Int);
+    EXPECT_EQ(var_type(p, t, "S"), ValueType::Int);
+    EXPECT_EQ(var_type(p, t, "J"), ValueType::Int);
+    EXPECT_EQ(t.int_vars(), 3u);
+}
+
+TEST(Types, DoubleSourcesPropagateThroughAssignments){
+    FlatProgram p = flat_of(
+        "10 LET A = 1.5\n"
+        "20 LET B = A + 1\n"      // A'dan
+        "30 LET C = B * 2\n"      // B üzerinden
+        "40 LET D = 6 / 3\n"      // bölme hep kesirli
+        "50 INPUT E\n"
+        "60 LET F = E < 3\n"      // karşılaştırma tamsayı
+        "70 LET G = 1E20\n"       // 2^53 üstü
+        "80 LET H = 2E3\n");
+    TypeInfo t = infer_types(p);
+    EXPECT_EQ(var_type(p, t, "A"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "B"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "C"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "D"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "E"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "F"), ValueType::Int);
+    EXPECT_EQ(var_type(p, t, "G"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "H"), ValueType::Int);
+}
+
+TEST(Types, LaterAssignmentTaintsEarlierReads){
+    // X önce tamsayı atanır ama sonraki bir LET onu kesirli yapar; Y de onu okur.
+    FlatProgram p = flat_of("10 LET X = 1\n20 LET Y = X + 1\n30 LET X = X / 2\n40 GOTO 20\n");
+    TypeInfo t = infer_types(p);
+    EXPECT_EQ(var_type(p, t, "X"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "Y"), ValueType::Double);
+    EXPECT_EQ(t.exprs[p.stmt_b[0]], ValueType::Int);
+    EXPECT_EQ(t.exprs[p.stmt_b[1]], ValueType::Double);
+}
+
+TEST(Types, EmptyProgram){
+    TypeInfo t = infer_types(FlatProgram{});
+    EXPECT_TRUE(t.vars.empty());
+    EXPECT_EQ(t.int_vars(), 0u);
+}
+
+TEST(Types, WorksAfterOptimize){
+    FlatProgram p = flat_of("10 LET A = 2 * 3\n20 LET B = A + 0.5\n30 PRINT A, B\n");
+    optimize(p);
+    TypeInfo t = infer_types(p);
+    EXPECT_EQ(t.exprs.size(), p.expr_kind.size());
+    EXPECT_EQ(var_type(p, t, "A"), ValueType::Int);
+    EXPECT_EQ(var_type(p, t, "B"), ValueType::Double);
+}
+
+TEST(Types, TypedCodegenDeclaresInt64PerStorage){
+    FlatProgram p = flat_of("10 LET I = 3\n20 LET R = I / 2\n30 PRINT I, R\n");
+    CodegenOptions opts; opts.typed = true;
+
+    opts.vars = VarStorage::Locals;
+    std::string code = Codegen::emit_cpp(p, opts);
+    EXPECT_NE(code.find("#include <cstdint>"), std::string::npos);
+    EXPECT_NE(code.find("std::int64_t v_I = 0;"), std::string::npos);
+    EXPECT_NE(code.find("double v_R = 0;"), std::string::npos);
+    // İki tamsayı işlenen C++'ta kesirli bölünmelidir.
+    EXPECT_NE(code.find("(double(v_I) / 2)"), std::string::npos);
+
+    opts.vars = VarStorage::Slots;
+    code = Codegen::emit_cpp(p, opts);
+    EXPECT_NE(code.find("double slots[1] = {};  // 0: R"), std::string::npos);
+    EXPECT_NE(code.find("std::int64_t islots[1] = {};  // 0: I"), std::string::npos);
+    EXPECT_NE(code.find("islots[0] = 3;"), std::string::npos);
+
+    opts.vars = VarStorage::Map;
+    code = Codegen::emit_cpp(p, opts);
+    EXPECT_NE(code.find("std::unordered_map<std::string,std::int64_t> ivar;"), std::string::npos);
+    EXPECT_NE(code.find("ivar[\"I\"] = 3;"), std::string::npos);
+    EXPECT_NE(code.find("var[\"R\"] = (double(ivar[\"I\"]) / 2);"), std::string::npos);
+}
+
+TEST(Types, UntypedOutputUnchanged){
+    FlatProgram p = flat_of("10 LET I = 3\n20 LET R = I / 2\n30 PRINT I, R\n");
+    for (VarStorage v : {VarStorage::Map, VarStorage::Slots, VarStorage::Locals}){
+        CodegenOptions opts; opts.vars = v;
+        std::string code = Codegen::emit_cpp(p, opts);
+        EXPECT_EQ(code.find("int64_t"), std::string::npos);
+        EXPECT_EQ(code.find("double("), std::string::npos);
+    }
+}
+
+TEST(Types, AllDoubleProgramNeedsNoCstdint){
+    FlatProgram p = flat_of("10 INPUT X\n20 PRINT X / 2\n");
+    CodegenOptions opts; opts.typed = true; opts.vars = VarStorage::Slots;
+    std::string code = Codegen::emit_cpp(p, opts);
+    EXPECT_EQ(code.find("cstdint"), std::string::npos);
+    EXPECT_EQ(code.find("islots"), std::string::npos);
+    EXPECT_NE(code.find("double slots[1] = {};  // 0: X"), std::string::npos);
+}
+
+TEST(Types, ValuesThatDoubleWouldPrintDifferentlyStayDouble){
+    FlatProgram p = flat_of(
+        "10 LET J = 3\n"
+        "20 LET Z = -J * B\n"         // 3 × 0 double'da -0 verir
+        "30 LET P = J * 2\n"          // pozitif sabit çarpan işareti korur
+        "40 FOR I = 1 TO 25\n"
+        "50 LET C = C * 10 + 1\n"     // kendini çarparak büyür
+        "60 LET D = D + D\n"          // kendini iki kez toplar
+        "70 LET S = S + I\n"          // döngüde kendinden hesaplanır
+        "80 NEXT I\n"
+        "90 LET M = 100000000 * 100000000\n"   // sınır 2^53 üstü
+        "100 LET N = 1000 * 1000\n");
+    TypeInfo t = infer_types(p);
+    EXPECT_EQ(var_type(p, t, "Z"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "P"), ValueType::Int);
+    EXPECT_EQ(var_type(p, t, "C"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "D"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "S"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "I"), ValueType::Int);     // kapalı döngünün sayacı
+    EXPECT_EQ(var_type(p, t, "M"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "N"), ValueType::Int);
+}
+
+TEST(Types, TypedOutputMatchesRun){
+    if (!have_compiler()) GTEST_SKIP() << "no C++ compiler: " << TRANSLATOR_TEST_CXX;
+    const char* src =
+        "10 LET B = 1234567\n"
+        "20 PRINT B, B * 2, 1000 * 1000\n"
+        "30 LET J = 3\n"
+        "35 INPUT X\n"
+        "40 PRINT -J * K, 3 * 0 - J, X\n"
+        "50 FOR I = 1 TO 25\n"
+        "60 LET C = C * 10 + 1\n"
+        "70 LET S = S + I\n"
+        "80 NEXT I\n"
+        "90 PRINT C, S, I, 7 / 2, S / 2\n"
+        "100 LET Y = 1000000000000001\n"
+        "110 LET W = W + Y\n"           // döngüde başka bir değişkeni toplar; sınırı bilinmez
+        "120 IF W < 30000000000000000000 THEN 110\n"
+        "130 PRINT W\n";
+    Lexer lx(src);
+    const Program p = Parser(lx).parseProgram();
+    const std::string expected = translator_test::run_vm(src, "3");
+    ASSERT_EQ(expected, "1.23457e+062.46913e+061e+06\n-0-33\n1.11111e+24325263.5162.5\n3e+19\n");
+
+    for (VarStorage v : {VarStorage::Map, VarStorage::Slots, VarStorage::Locals}){
+        for (bool opt : {false, true}){
+            CodegenOptions o; o.vars = v; o.flow = ControlFlow::Structured; o.typed = true; o.optimize = opt;
+            const std::string name = "typed_" + std::to_string(static_cast<int>(v)) + (opt ? "_O" : "");
+            // INPUT derlenen programa ortam yerine sabit kaynaktan verilir.
+            std::string code = Codegen::emit_cpp(p, o);
+            const std::string cin = "std::cin >> tmp;";
+            ASSERT_NE(code.find(cin), std::string::npos);
+            code.replace(code.find(cin), cin.size(), "tmp = 3;");
+            std::string got;
+            ASSERT_TRUE(compile_and_run(name, code, got));
+            EXPECT_EQ(got, expected) << code;
+        }
+    }
+}
+
+TEST(Types, InputLimitLeavesCounterUnbounded){
+    const char* src =
+        "10 INPUT N\n"
+        "20 FOR I = 0 TO N STEP 1000000000000001\n"   // sınır okunan değerdir; 2^53'ü aşabilir
+        "30 NEXT I\n"
+        "40 LET D = I - 100000000000000000\n"
+        "50 PRINT D\n";
+    FlatProgram f = flat_of(src);
+    TypeInfo t = infer_types(f);
+    EXPECT_EQ(var_type(f, t, "N"), ValueType::Double);
+    EXPECT_EQ(var_type(f, t, "I"), ValueType::Double);
+
+    if (!have_compiler()) GTEST_SKIP() << "no C++ compiler: " << TRANSLATOR_TEST_CXX;
+    const std::string expected = translator_test::run_vm(src, "1e17");
+    ASSERT_EQ(expected, "16\n");
+    Lexer lx(src);
+    const Program p = Parser(lx).parseProgram();
+    for (VarStorage v : {VarStorage::Map, VarStorage::Slots, VarStorage::Locals}){
+        CodegenOptions o; o.vars = v; o.flow = ControlFlow::Structured; o.typed = true;
+        std::string code = Codegen::emit_cpp(p, o);
+        const std::string cin = "std::cin >> tmp;";
+        ASSERT_NE(code.find(cin), std::string::npos);
+        code.replace(code.find(cin), cin.size(), "tmp = 1e17;");
+        std::string got;
+        ASSERT_TRUE(compile_and_run("typed_input_" + std::to_string(static_cast<int>(v)), code, got));
+        EXPECT_EQ(got, expected) << code;
+    }
+}
+
+TEST(Types, OnlyClosedLoopCountersAreBounded){
+    FlatProgram p = flat_of(
+        "10 FOR I = 1 TO 10\n"
+        "20 NEXT I\n"
+        "30 FOR K = 1 TO 3\n"          // gövdeye dışarıdan atlanır
+        "40 LET Q = K\n"
+        "50 NEXT K\n"
+        "60 IF Q < 5 THEN 40\n"
+        "70 FOR G = 1 TO 3\n"          // gövdede GOSUB var
+        "80 GOSUB 110\n"
+        "90 NEXT G\n"
+        "100 GOTO 120\n"
+        "110 RETURN\n"
+        "120 LET X = X + Y\n"          // başka değişkeni toplar
+        "130 LET U = U + 1\n");        // kendini artırır
+    TypeInfo t = infer_types(p);
+    EXPECT_EQ(var_type(p, t, "I"), ValueType::Int);
+    EXPECT_EQ(var_type(p, t, "K"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "Q"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "G"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "X"), ValueType::Double);
+    EXPECT_EQ(var_type(p, t, "U"), ValueType::Double);
+}
@@ -0,0 +1,107 @@
+/**
+ * @file test_translator_vm.cpp
+ * @brief Bayt kodu derleyicisi ve yorumlayıcısı için testler.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator/vm.h"
+#include "translator_run.h"
+
+using namespace translator;
+using translator_test::run_vm;
+
+namespace {
+
+/// Kaynağı bayt koduna derler.
+Bytecode compile(const std::string& src){
+    Lexer lx(src);
+    Parser ps(lx);
+    return compile_bytecode(ps.parseProgram());
+}
+
+} // namespace
+
+TEST(Vm, EvaluatesExpressionsAndPrints) {
+    EXPECT_EQ(run_vm("10 LET X = 1 + 2 * 3\n20 PRINT X, X / 2, (X - 1) * 2\n"), "73.512\n");
+    // Üretilen C++ gibi akışın varsayılan biçimiyle yazar.
+    EXPECT_EQ(run_vm("10 PRINT 1 / 3\n"), "0.333333\n");
+}
+
+TEST(Vm, UndefinedVariablesStartAtZero) {
+    EXPECT_EQ(run_vm("10 PRINT Y + 1\n"), "1\n");
+}
+
+TEST(Vm, InputReadsNumbers) {
+    EXPECT_EQ(run_vm("10 INPUT A\n20 INPUT B\n30 PRINT A * B\n", "6 7"), "42\n");
+    // Girdi bitince okunan değer 0 olur.
+    EXPECT_EQ(run_vm("10 INPUT A\n20 PRINT A\n", ""), "0\n");
+}
+
+TEST(Vm, LoopsWithIfGoto) {
+    EXPECT_EQ(run_vm(
+        "10 LET I = 3\n"
+        "20 PRINT I\n"
+        "30 LET I = I - 1\n"
+        "40 IF I THEN 20\n"), "3\n2\n1\n");
+}
+
+TEST(Vm, GosubAndReturn) {
+    EXPECT_EQ(run_vm(
+        "10 GOSUB 100\n"
+        "20 GOSUB 100\n"
+        "30 PRINT N\n"
+        "40 GOTO 999\n"
+        "100 LET N = N + 1\n"
+        "110 PRINT N\n"
+        "120 RETURN\n"), "1\n2\n2\n");
+}
+
+TEST(Vm, TerminationMatchesGeneratedCode) {
+    // Olmayan etikete atlama programı bitirir.
+    EXPECT_EQ(run_vm("10 GOTO 50\n20 PRINT 1\n"), "");
+    // Boş çağrı yığınında RETURN programı bitirir.
+    EXPECT_EQ(run_vm("10 PRINT 1\n20 RETURN\n30 PRINT 2\n"), "1\n");
+    // Son deyimdeki GOSUB'un dönüş noktası yoktur; program biter.
+    EXPECT_EQ(run_vm("10 PRINT 1\n20 GOSUB 10\n"), "1\n");
+}
+
+TEST(Vm, CountsInstructionsAndResetsVariables) {
+    Bytecode bc = compile("10 LET X = X + 1\n");
+    VM vm(bc);
+    std::istringstream in;
+    std::ostringstream out;
+    // Load, Const, Add, Store, Halt
+    EXPECT_EQ(vm.run(in, out), 5u);
+    EXPECT_EQ(vm.run(in, out), 5u);
+    ASSERT_EQ(vm.variables().size(), 1u);
+    EXPECT_EQ(vm.variables()[0], 1.0);
+}
+
+TEST(Vm, BytecodeLayout) {
+    Bytecode bc = compile("10 LET X = (1 + 2) * (3 + 4)\n20 IF X THEN 10\n");
+    EXPECT_EQ(bc.max_stack, 3u);
+    ASSERT_EQ(bc.stmt_pc.size(), 2u);
+    EXPECT_EQ(bc.stmt_pc[1], 8);
+    EXPECT_EQ(bc.code.back().op, OpCode::Halt);
+    const Instr& branch = bc.code[bc.stmt_pc[1] + 1];
+    EXPECT_EQ(branch.op, OpCode::JumpIf);
+    EXPECT_EQ(branch.arg, 0);
+    std::string listing = disassemble(bc);
+    EXPECT_NE(listing.find("0: Const 0  ; 1\n"), std::string::npos) << listing;
+    EXPECT_NE(listing.find("7: Store 0  ; X\n"), std::string::npos) << listing;
+    EXPECT_NE(listing.find("9: JumpIf 0\n"), std::string::npos) << listing;
+}
+
+TEST(Vm, EmptyProgramHalts) {
+    Program prog;
+    Bytecode bc = compile_bytecode(prog);
+    ASSERT_EQ(bc.code.size(), 1u);
+    VM vm(bc);
+    std::istringstream in;
+    std::ostringstream out;
+    EXPECT_EQ(vm.run(in, out), 1u);
+}
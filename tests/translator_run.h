@@ -0,0 +1,124 @@
+/**
+ * @file translator_run.h
+ * @brief Translator testleri için ortak yardımcılar: dosya okuma, kaynağı düzleştirme, C++'a çevirme, yorumlayıcıda ya da VM'de çalıştırma ve üretilen kodu derleyip çalıştırma
+ * @author Mustafa Yıldırım
+ * @date 2025
+ * @version 1.0
+ */
+#pragma once
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "translator/codegen.h"
+#include "translator/flat_ast.h"
+#include "translator/interpreter.h"
+#include "translator/lexer.h"
+#include "translator/parser.h"
+#include "translator/vm.h"
+
+#ifndef TRANSLATOR_TEST_CXX
+#define TRANSLATOR_TEST_CXX "c++"
+#endif
+
+namespace translator_test {
+
+/**
+ * @brief Dosyanın tamamını ikili kipte okur
+ * @param path Dosya yolu
+ * @return Dosya içeriği; açılamazsa boş
+ */
+inline std::string read_file(const std::string& path){
+    std::ifstream in(path, std::ios::binary);
+    std::ostringstream ss; ss << in.rdbuf();
+    return ss.str();
+}
+
+/**
+ * @brief Kaynağı çözümleyip düz programa çevirir
+ * @param src BASIC kaynağı
+ * @return Düz program
+ */
+inline translator::FlatProgram flat_of(const std::string& src){
+    translator::Lexer lx(src);
+    return translator::flatten(translator::Parser(lx).parseProgram());
+}
+
+/**
+ * @brief Kaynağı verilen seçeneklerle C++'a çevirir
+ * @param src BASIC kaynağı
+ * @param opts Üretim seçenekleri
+ * @return Üretilen C++ kodu
+ */
+inline std::string emit(const std::string& src, const translator::CodegenOptions& opts = {}){
+    translator::Lexer lx(src);
+    return translator::Codegen::emit_cpp(translator::Parser(lx).parseProgram(), opts);
+}
+
+/**
+ * @brief Kaynağı ağaç yürütücü yorumlayıcıda çalıştırır
+ * @param src BASIC kaynağı
+ * @param input INPUT için okunacak metin
+ * @return Programın çıktısı
+ */
+inline std::string interpret(const std::string& src, const std::string& input = ""){
+    translator::Lexer lx(src);
+    translator::Program p = translator::Parser(lx).parseProgram();
+    std::istringstream in(input); std::ostringstream out;
+    translator::Interpreter(p).run(in, out);
+    return out.str();
+}
+
+/**
+ * @brief Kaynağı bayt koduna derleyip VM'de çalıştırır
+ * @param src BASIC kaynağı
+ * @param input INPUT için okunacak metin
+ * @return Programın çıktısı
+ */
+inline std::string run_vm(const std::string& src, const std::string& input = ""){
+    translator::Lexer lx(src);
+    translator::Bytecode bc = translator::compile_bytecode(translator::Parser(lx).parseProgram());
+    std::istringstream in(input); std::ostringstream out;
+    translator::VM(bc).run(in, out);
+    return out.str();
+}
+
+/**
+ * @brief Sistem derleyicisi var mı? Boş bir program bir kez derlenir
+ * @return Derleme başarılıysa true
+ */
+inline bool have_compiler(){
+    namespace fs = std::filesystem;
+    static const bool ok = []{
+        fs::path dir = fs::temp_directory_path() / "translator_test";
+        fs::create_directories(dir);
+        std::ofstream(dir / "probe.cpp") << "int main(){ return 0; }\n";
+        std::string cc = std::string(TRANSLATOR_TEST_CXX) + " -o \"" + (dir / "probe").string() + "\" \"" + (dir / "probe.cpp").string() + "\"";
+        return std::system(cc.c_str()) == 0;
+    }();
+    return ok;
+}
+
+/**
+ * @brief Üretilen kodu derleyip çalıştırır
+ * @param name Geçici dosyaların adı
+ * @param code Üretilen C++ kodu
+ * @param output Programın çıktısı
+ * @return Başarı; derleyici tanıları ya da çıkış kodu hata iletisine girer
+ */
+inline ::testing::AssertionResult compile_and_run(const std::string& name, const std::string& code, std::string& output){
+    namespace fs = std::filesystem;
+    fs::path dir = fs::temp_directory_path() / "translator_test";
+    fs::path src = dir / (name + ".cpp"), exe = dir / name, out = dir / (name + ".out"), err = dir / (name + ".err");
+    std::ofstream(src) << code;
+    std::string cc = std::string(TRANSLATOR_TEST_CXX) + " -O2 -o \"" + exe.string() + "\" \"" + src.string() + "\" 2> \"" + err.string() + "\"";
+    if (std::system(cc.c_str()) != 0) return ::testing::AssertionFailure() << "compile failed:\n" << read_file(err.string()) << "\n" << code;
+    std::string run = "\"" + exe.string() + "\" > \"" + out.string() + "\"";
+    if (int rc = std::system(run.c_str()); rc != 0) return ::testing::AssertionFailure() << "run failed with status " << rc << "\n" << code;
+    output = read_file(out.string());
+    return ::testing::AssertionSuccess();
+}
+
+} // namespace translator_test